@@ -0,0 +1,52 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/coroutine.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/tasks.h"
+
+namespace unrealsdk::coroutine {
+
+namespace impl {
+
+void Detached::promise_type::unhandled_exception(void) noexcept {
+    try {
+        throw;
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred while running a spawned task: {}", ex.what());
+    } catch (...) {
+        LOG(ERROR, "An unknown exception occurred while running a spawned task");
+    }
+}
+
+}  // namespace impl
+
+void HookAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    // The hook only lives until it fires once. The state is kept in the hook itself, since the
+    // awaiter is freed as soon as the coroutine it lives in completes. It's address is also unique
+    // for as long as the hook exists, so doubles as a unique identifier.
+    auto fired = std::make_shared<bool>(false);
+    auto identifier = unrealsdk::fmt::format(L"unrealsdk_coroutine_{:x}",
+                                             reinterpret_cast<uintptr_t>(fired.get()));
+
+    hook_manager::add_hook(
+        this->func, this->type, identifier,
+        [this, handle, fired, func = this->func, type = this->type,
+         identifier](hook_manager::Details& hook) {
+            if (*fired) {
+                return false;
+            }
+            *fired = true;
+
+            // Can't remove the hook from inside itself, since that would free this callback while
+            // we're still running it - defer it until the next tick instead
+            tasks::queue(
+                [func, type, identifier]() { hook_manager::remove_hook(func, type, identifier); },
+                tasks::Priority::HIGH);
+
+            this->details = &hook;
+            handle.resume();
+            return false;
+        });
+}
+
+}  // namespace unrealsdk::coroutine
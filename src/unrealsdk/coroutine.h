@@ -0,0 +1,274 @@
+#ifndef UNREALSDK_COROUTINE_H
+#define UNREALSDK_COROUTINE_H
+
+#include "unrealsdk/pch.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/tasks.h"
+
+namespace unrealsdk::coroutine {
+
+/*
+You can use this module to write logic spanning multiple frames or game events as a coroutine.
+
+```
+coroutine::Task<void> example(void) {
+    auto& hook = co_await coroutine::hook_fired(L"Engine.PlayerController:ClientRestart");
+    LOG(INFO, L"Restarted {}", hook.obj->get_path_name());
+
+    for (auto i = 0; i < 10; i++) {
+        co_await coroutine::next_tick();
+    }
+    LOG(INFO, "Ten frames later");
+}
+
+coroutine::spawn(example());
+```
+
+Tasks are lazy, they don't start running until they're either awaited by another task, or spawned.
+Suspended coroutines don't cost anything while waiting, they're just resumed directly by whatever
+they're waiting on - a queued task, or a temporary hook.
+
+Coroutines should be left to run to completion - destroying a task while it's suspended waiting on
+one of the awaitables in this file is undefined behaviour, since they'll still try resume it.
+*/
+
+template <typename T>
+class Task;
+
+namespace impl {
+
+/**
+ * @brief The parts of a task's promise which don't depend on it's return type.
+ */
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    /**
+     * @brief Awaitable which transfers execution back to whatever was awaiting the task.
+     */
+    struct FinalAwaiter {
+        [[nodiscard]] static bool await_ready(void) noexcept { return false; }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) const noexcept {
+            auto continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+        static void await_resume(void) noexcept {}
+    };
+
+    [[nodiscard]] static std::suspend_always initial_suspend(void) noexcept { return {}; }
+    [[nodiscard]] static FinalAwaiter final_suspend(void) noexcept { return {}; }
+    void unhandled_exception(void) noexcept { this->exception = std::current_exception(); }
+
+    /**
+     * @brief Rethrows the exception the task exited with, if any.
+     */
+    void rethrow_if_exception(void) const {
+        if (this->exception) {
+            std::rethrow_exception(this->exception);
+        }
+    }
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    std::optional<T> value;
+
+    [[nodiscard]] Task<T> get_return_object(void) noexcept;
+    template <typename V>
+    void return_value(V&& value) {
+        this->value.emplace(std::forward<V>(value));
+    }
+
+    [[nodiscard]] T take_result(void) {
+        this->rethrow_if_exception();
+        return std::move(*this->value);
+    }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    [[nodiscard]] Task<void> get_return_object(void) noexcept;
+    static void return_void(void) noexcept {}
+
+    void take_result(void) const { this->rethrow_if_exception(); }
+};
+
+/**
+ * @brief A fire-and-forget coroutine, used to run spawned tasks.
+ */
+struct Detached {
+    struct promise_type {  // NOLINT(readability-identifier-naming)
+        [[nodiscard]] static Detached get_return_object(void) noexcept { return {}; }
+        [[nodiscard]] static std::suspend_never initial_suspend(void) noexcept { return {}; }
+        [[nodiscard]] static std::suspend_never final_suspend(void) noexcept { return {}; }
+        static void return_void(void) noexcept {}
+        static void unhandled_exception(void) noexcept;
+    };
+};
+
+}  // namespace impl
+
+/**
+ * @brief A lazily started coroutine.
+ * @note Awaiting a task starts it, and resumes the awaiter with it's result once it completes.
+ *
+ * @tparam T The type the coroutine returns.
+ */
+template <typename T = void>
+class [[nodiscard]] Task {
+   public:
+    using promise_type = impl::Promise<T>;  // NOLINT(readability-identifier-naming)
+    using handle_type = std::coroutine_handle<promise_type>;
+
+   private:
+    handle_type handle;
+
+   public:
+    /**
+     * @brief Constructs a task owning the given coroutine.
+     *
+     * @param handle The coroutine handle.
+     */
+    explicit Task(handle_type handle) noexcept : handle(handle) {}
+
+    Task(const Task&) = delete;
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (this->handle) {
+                this->handle.destroy();
+            }
+            this->handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task() {
+        if (this->handle) {
+            this->handle.destroy();
+        }
+    }
+
+    /**
+     * @brief Awaitable which starts the task, and resumes the awaiter once it completes.
+     */
+    struct Awaiter {
+        handle_type handle;
+
+        [[nodiscard]] bool await_ready(void) const noexcept {
+            return !this->handle || this->handle.done();
+        }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) const noexcept {
+            this->handle.promise().continuation = awaiter;
+            return this->handle;
+        }
+        T await_resume(void) const {
+            if (!this->handle) {
+                throw std::logic_error("Tried to await an empty task!");
+            }
+            return this->handle.promise().take_result();
+        }
+    };
+
+    Awaiter operator co_await(void) && noexcept { return {this->handle}; }
+};
+
+namespace impl {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object(void) noexcept {
+    return Task<T>{std::coroutine_handle<Promise<T>>::from_promise(*this)};
+}
+
+inline Task<void> Promise<void>::get_return_object(void) noexcept {
+    return Task<void>{std::coroutine_handle<Promise<void>>::from_promise(*this)};
+}
+
+}  // namespace impl
+
+/**
+ * @brief Starts running a task, without waiting on it.
+ * @note The task's result is discarded. Any exceptions it throws are logged.
+ *
+ * @tparam T The task's return type.
+ * @param task The task to run.
+ */
+template <typename T>
+impl::Detached spawn(Task<T> task) {
+    // Taking the task by value moves it into this coroutine's frame, keeping it alive until done
+    if constexpr (std::is_void_v<T>) {
+        co_await std::move(task);
+    } else {
+        (void)co_await std::move(task);
+    }
+}
+
+/**
+ * @brief Gets an awaitable which resumes the awaiting coroutine on the next frame.
+ *
+ * @return The awaitable.
+ */
+[[nodiscard]] inline tasks::ScheduleAwaiter next_tick(void) {
+    // High priority so that we always resume exactly one frame later, regardless of budget
+    return tasks::schedule(tasks::Priority::HIGH);
+}
+
+/**
+ * @brief Awaitable which moves the awaiting coroutine onto the game thread.
+ */
+struct GameThreadAwaiter {
+    tasks::Priority priority;
+
+    [[nodiscard]] static bool await_ready(void) { return tasks::is_game_thread(); }
+    void await_suspend(std::coroutine_handle<> handle) const {
+        tasks::ScheduleAwaiter{this->priority}.await_suspend(handle);
+    }
+    static void await_resume(void) noexcept {}
+};
+
+/**
+ * @brief Gets an awaitable which ensures the awaiting coroutine continues on the game thread.
+ * @note If already on the game thread, continues immediately.
+ *
+ * @param priority The priority to resume at, if needing to switch threads.
+ * @return The awaitable.
+ */
+[[nodiscard]] inline GameThreadAwaiter on_game_thread(
+    tasks::Priority priority = tasks::Priority::NORMAL) {
+    return {priority};
+}
+
+/**
+ * @brief Awaitable which resumes the awaiting coroutine the next time a function is called.
+ */
+struct HookAwaiter {
+    std::wstring func;
+    hook_manager::Type type;
+    hook_manager::Details* details;
+
+    [[nodiscard]] static bool await_ready(void) noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+    [[nodiscard]] hook_manager::Details& await_resume(void) const noexcept {
+        return *this->details;
+    }
+};
+
+/**
+ * @brief Gets an awaitable which resumes the awaiting coroutine the next time a function is called.
+ * @note The coroutine is resumed from within the hook. The returned hook details are only valid
+ *       until the coroutine next suspends.
+ *
+ * @param func The function to wait on.
+ * @param type Which type of hook to wait on.
+ * @return The awaitable.
+ */
+[[nodiscard]] inline HookAwaiter hook_fired(std::wstring_view func,
+                                            hook_manager::Type type = hook_manager::Type::PRE) {
+    return {.func = std::wstring{func}, .type = type, .details = nullptr};
+}
+
+}  // namespace unrealsdk::coroutine
+
+#endif /* UNREALSDK_COROUTINE_H */
@@ -0,0 +1,280 @@
+#ifndef UNREALSDK_DEFERRED_LOG_H
+#define UNREALSDK_DEFERRED_LOG_H
+
+#include "unrealsdk/pch.h"
+#include "unrealsdk/logging.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::logging {
+
+/*
+Deferred log messages store their raw arguments into a fixed size binary record, and only format
+them when they're dumped. This makes them far cheaper than a regular log message, so they can be
+left in hot paths which you only occasionally need to debug.
+
+```
+LOG_DEFERRED(MISC, "Called {} on {}", func->Name, obj->Name);
+// Later...
+logging::dump_deferred();
+```
+
+The format string must be a string literal - only it's address is stored. The location and the
+function used to decode the record are also stored by address, so records from a module are no
+longer valid once it's unloaded.
+
+Arguments may be narrow or wide strings (which are copied into the record, truncated if too long),
+pointers, or any other trivially copyable type. Note that trivially copyable types are stored by
+value, if they point at other memory (e.g. a span), that memory must still be valid when dumping.
+
+If deferred logging is not enabled, messages are formatted and logged immediately instead.
+*/
+
+namespace impl {
+
+// The maximum amount of bytes of arguments a single record may hold
+constexpr size_t DEFERRED_ARGS_SIZE = 0xC0;
+// The maximum length of a single formatted message
+constexpr size_t DEFERRED_MSG_SIZE = 0x400;
+
+template <typename T>
+constexpr bool is_deferred_narrow_string_v = std::is_convertible_v<const T&, std::string_view>;
+
+template <typename T>
+constexpr bool is_deferred_wide_string_v = std::is_convertible_v<const T&, std::wstring_view>;
+
+template <typename T>
+constexpr bool is_deferred_string_v =
+    is_deferred_narrow_string_v<T> || is_deferred_wide_string_v<T>;
+
+/**
+ * @brief Gets how many bytes of an argument's stored form don't depend on it's value.
+ *
+ * @tparam T The argument type.
+ * @return The argument's fixed size.
+ */
+template <typename T>
+constexpr size_t deferred_fixed_size(void) {
+    if constexpr (is_deferred_string_v<T>) {
+        return sizeof(uint32_t);
+    } else if constexpr (std::is_pointer_v<std::decay_t<T>>) {
+        return sizeof(const void*);
+    } else {
+        static_assert(std::is_trivially_copyable_v<std::decay_t<T>>,
+                      "Deferred log arguments must be strings or trivially copyable");
+        return sizeof(std::decay_t<T>);
+    }
+}
+
+/**
+ * @brief The type an argument's stored form is decoded back into.
+ */
+template <typename T>
+using deferred_decoded_t = std::conditional_t<
+    is_deferred_string_v<T>,
+    std::conditional_t<is_deferred_narrow_string_v<T>, std::string_view, std::string>,
+    std::conditional_t<std::is_pointer_v<std::decay_t<T>>, const void*, std::decay_t<T>>>;
+
+/**
+ * @brief Helper to write arguments into a record.
+ */
+struct DeferredArgWriter {
+    uint8_t* data;
+    size_t pos;
+    size_t string_budget;
+
+    void write_bytes(const void* src, size_t size) {
+        memcpy(data + pos, src, size);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        this->pos += size;
+    }
+
+    template <typename T>
+    void write(const T& arg) {
+        if constexpr (is_deferred_string_v<T>) {
+            using view_type = std::conditional_t<is_deferred_narrow_string_v<T>, std::string_view,
+                                                 std::wstring_view>;
+            using char_type = typename view_type::value_type;
+            const view_type str{arg};
+
+            auto count = std::min(str.size(), this->string_budget / sizeof(char_type));
+            this->string_budget -= count * sizeof(char_type);
+
+            auto stored_count = static_cast<uint32_t>(count);
+            this->write_bytes(&stored_count, sizeof(stored_count));
+            this->write_bytes(str.data(), count * sizeof(char_type));
+        } else if constexpr (std::is_pointer_v<std::decay_t<T>>) {
+            auto ptr = static_cast<const void*>(arg);
+            this->write_bytes(&ptr, sizeof(ptr));
+        } else {
+            this->write_bytes(&arg, sizeof(arg));
+        }
+    }
+};
+
+/**
+ * @brief Helper to read arguments back out of a record.
+ */
+struct DeferredArgReader {
+    const uint8_t* data;
+    size_t pos;
+
+    void read_bytes(void* dest, size_t size) {
+        memcpy(dest, data + pos, size);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        this->pos += size;
+    }
+
+    template <typename T>
+    deferred_decoded_t<T> read(void) {
+        if constexpr (is_deferred_string_v<T>) {
+            uint32_t count = 0;
+            this->read_bytes(&count, sizeof(count));
+
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,
+            //             cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if constexpr (is_deferred_narrow_string_v<T>) {
+                const std::string_view str{reinterpret_cast<const char*>(data + pos), count};
+                this->pos += count;
+                return str;
+            } else {
+                // Copy out, since the data may not be aligned
+                std::wstring str(count, L'\0');
+                this->read_bytes(str.data(), count * sizeof(wchar_t));
+                return utils::narrow(str);
+            }
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,
+            //           cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        } else {
+            // Not all trivially copyable types are default constructable
+            std::array<uint8_t, sizeof(deferred_decoded_t<T>)> raw{};
+            this->read_bytes(raw.data(), raw.size());
+            return std::bit_cast<deferred_decoded_t<T>>(raw);
+        }
+    }
+};
+
+/**
+ * @brief Formats a deferred record.
+ *
+ * @tparam Args The types of the arguments the record was written with.
+ * @param format The format string.
+ * @param args The record's stored arguments.
+ * @param out The buffer to write the formatted message to.
+ * @param out_size The size of the buffer.
+ * @return The length of the formatted message.
+ */
+template <typename... Args>
+size_t decode_deferred(const char* format, const uint8_t* args, char* out, size_t out_size) {
+    std::string msg{};
+    try {
+        [[maybe_unused]] DeferredArgReader reader{.data = args, .pos = 0};
+        // Braced init guarantees left to right evaluation
+        std::tuple<deferred_decoded_t<Args>...> values{reader.read<Args>()...};
+
+        msg = std::apply(
+            [format](auto&... decoded) {
+                return unrealsdk::fmt::vformat(format,
+                                               unrealsdk::fmt::make_format_args(decoded...));
+            },
+            values);
+    } catch (const std::exception& ex) {
+        msg = std::string{"Failed to format deferred log message: "} + ex.what();
+    }
+
+    auto size = std::min(msg.size(), out_size);
+    memcpy(out, msg.data(), size);
+    return size;
+}
+
+}  // namespace impl
+
+/**
+ * @brief Function used to format a deferred record.
+ * @note Writes into a buffer rather than returning a string, since it may be called from another
+ *       module.
+ */
+using deferred_decoder = size_t (*)(const char* format,
+                                    const uint8_t* args,
+                                    char* out,
+                                    size_t out_size);
+
+/**
+ * @brief Writes a deferred log record.
+ * @note Should generally use the `LOG_DEFERRED()` macro over this.
+ *
+ * @param level The log level.
+ * @param format The format string. Must be static.
+ * @param decoder The function used to format the record.
+ * @param args The record's stored arguments.
+ * @param args_size The size of the stored arguments.
+ * @param location The location the message was logged from.
+ * @param line The line number the message was logged from.
+ */
+void log_deferred(Level level,
+                  const char* format,
+                  deferred_decoder decoder,
+                  const uint8_t* args,
+                  size_t args_size,
+                  const char* location,
+                  int line);
+
+/**
+ * @brief Writes a deferred log record from a set of arguments.
+ * @note Should generally use the `LOG_DEFERRED()` macro over this.
+ *
+ * @tparam N The length of the format string.
+ * @tparam Args The argument types.
+ * @param level The log level.
+ * @param location The location the message was logged from.
+ * @param line The line number the message was logged from.
+ * @param format The format string. Must be static.
+ * @param args The format arguments.
+ */
+template <size_t N, typename... Args>
+void log_deferred(Level level,
+                  const char* location,
+                  int line,
+                  const char (&format)[N],  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                  const Args&... args) {
+    constexpr size_t fixed_size = (0 + ... + impl::deferred_fixed_size<Args>());
+    static_assert(fixed_size <= impl::DEFERRED_ARGS_SIZE, "Too many deferred log arguments");
+
+    // Leave the buffer uninitialized, we only read back what we write
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    std::array<uint8_t, impl::DEFERRED_ARGS_SIZE> buffer;
+    impl::DeferredArgWriter writer{
+        .data = buffer.data(), .pos = 0, .string_budget = impl::DEFERRED_ARGS_SIZE - fixed_size};
+    (writer.write(args), ...);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    log_deferred(level, format, &impl::decode_deferred<Args...>, buffer.data(), writer.pos,
+                 location, line);
+}
+
+/**
+ * @brief Formats and logs all deferred records written since the last dump.
+ * @note Records which get overwritten before they can be dumped are skipped. Records which are
+ *       still being written are left for the next dump.
+ */
+void dump_deferred(void);
+
+}  // namespace unrealsdk::logging
+
+/**
+ * @brief Writes a deferred log message.
+ *
+ * @param level The log level name.
+ * @param ... The format string literal + it's contents.
+ */
+// NOLINTBEGIN(cppcoreguidelines-macro-usage, cppcoreguidelines-avoid-do-while)
+#define LOG_DEFERRED(level, ...)                                                                  \
+    do {                                                                                          \
+        if constexpr (unrealsdk::logging::Level::level >= unrealsdk::logging::COMPILE_MIN_LEVEL) { \
+            if (unrealsdk::logging::is_enabled(unrealsdk::logging::Level::level)) {               \
+                unrealsdk::logging::log_deferred((unrealsdk::logging::Level::level),              \
+                                                 (const char*)(__FUNCTION__), (__LINE__),         \
+                                                 __VA_ARGS__);                                    \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+// NOLINTEND(cppcoreguidelines-macro-usage, cppcoreguidelines-avoid-do-while)
+
+#endif /* UNREALSDK_DEFERRED_LOG_H */
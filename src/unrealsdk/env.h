@@ -10,6 +10,14 @@ const constexpr env_var_key ENV_FILE = "UNREALSDK_ENV_FILE";
 const constexpr env_var_key EXTERNAL_CONSOLE = "UNREALSDK_EXTERNAL_CONSOLE";
 const constexpr env_var_key LOG_FILE = "UNREALSDK_LOG_FILE";
 const constexpr env_var_key LOG_LEVEL = "UNREALSDK_LOG_LEVEL";
+const constexpr env_var_key LOG_MIN_LEVEL = "UNREALSDK_LOG_MIN_LEVEL";
+const constexpr env_var_key LOG_ASYNC = "UNREALSDK_LOG_ASYNC";
+const constexpr env_var_key LOG_ASYNC_QUEUE_SIZE = "UNREALSDK_LOG_ASYNC_QUEUE_SIZE";
+const constexpr env_var_key LOG_DEFERRED_SIZE = "UNREALSDK_LOG_DEFERRED_SIZE";
+const constexpr env_var_key LOG_RATE_LIMIT_LEVEL = "UNREALSDK_LOG_RATE_LIMIT_LEVEL";
+const constexpr env_var_key LOG_RATE_LIMIT = "UNREALSDK_LOG_RATE_LIMIT";
+const constexpr env_var_key LOG_RATE_LIMIT_BURST = "UNREALSDK_LOG_RATE_LIMIT_BURST";
+const constexpr env_var_key LOG_DUPLICATE_WINDOW = "UNREALSDK_LOG_DUPLICATE_WINDOW";
 const constexpr env_var_key GAME_OVERRIDE = "UNREALSDK_GAME_OVERRIDE";
 const constexpr env_var_key UPROPERTY_SIZE = "UNREALSDK_UPROPERTY_SIZE";
 const constexpr env_var_key ALLOC_ALIGNMENT = "UNREALSDK_ALLOC_ALIGNMENT";
@@ -24,6 +32,8 @@ const constexpr env_var_key TREFERENCE_CONTROLLER_DESTRUCTOR_VF_INDEX =
     "UNREALSDK_TREFERENCE_CONTROLLER_DESTRUCTOR_VF_INDEX";
 const constexpr env_var_key FTEXT_GET_DISPLAY_STRING_VF_INDEX =
     "UNREALSDK_FTEXT_GET_DISPLAY_STRING_VF_INDEX";
+const constexpr env_var_key TASK_TICK_FUNC = "UNREALSDK_TASK_TICK_FUNC";
+const constexpr env_var_key TASK_FRAME_BUDGET = "UNREALSDK_TASK_FRAME_BUDGET";
 
 namespace defaults {
 
@@ -33,6 +43,14 @@ const constexpr auto ENV_FILE = "unrealsdk.env";
 const constexpr auto LOG_FILE = "unrealsdk.log";
 // EXTERNAL_CONSOLE - defaults to empty string (only used in defined checks)
 // LOG_LEVEL - defaults to empty string
+// LOG_MIN_LEVEL - defaults to empty string
+// LOG_ASYNC - defaults to empty string (only used in defined checks)
+const constexpr auto LOG_ASYNC_QUEUE_SIZE = 4096;
+// LOG_DEFERRED_SIZE - defaults to 0 (meaning disabled)
+// LOG_RATE_LIMIT_LEVEL - defaults to empty string (meaning warnings and above)
+const constexpr auto LOG_RATE_LIMIT = 20.0;
+const constexpr auto LOG_RATE_LIMIT_BURST = 50.0;
+const constexpr auto LOG_DUPLICATE_WINDOW = 1000;
 // GAME_OVERRIDE - defaults to executable filename - not constant so treat it as an empty string
 // UPROPERTY_SIZE - defaults to 0 (meaning auto)
 // ALLOC_ALIGNMENT - defaults to 0 (meaning auto)
@@ -42,6 +60,12 @@ const constexpr auto UCONSOLE_OUTPUT_TEXT_VF_INDEX = 83;
 const constexpr auto TREFERENCE_CONTROLLER_DESTROY_OBJ_VF_INDEX = 0;
 const constexpr auto TREFERENCE_CONTROLLER_DESTRUCTOR_VF_INDEX = 1;
 const constexpr auto FTEXT_GET_DISPLAY_STRING_VF_INDEX = 2;
+#ifdef UE4
+const constexpr auto TASK_TICK_FUNC = "/Script/Engine.HUD:ReceiveDrawHUD";
+#else
+const constexpr auto TASK_TICK_FUNC = "WillowGame.WillowGameViewportClient:PostRender";
+#endif
+const constexpr auto TASK_FRAME_BUDGET = 2000;
 
 }  // namespace defaults
 
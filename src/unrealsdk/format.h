@@ -12,8 +12,12 @@
 namespace unrealsdk::fmt {
 
 using std::format;
+using std::format_args;
 using std::format_context;
+using std::format_to;
 using std::formatter;
+using std::make_format_args;
+using std::vformat;
 
 }  // namespace unrealsdk::fmt
 
@@ -27,8 +31,12 @@ using std::formatter;
 namespace unrealsdk::fmt {
 
 using ::fmt::format;
+using ::fmt::format_args;
 using ::fmt::format_context;
+using ::fmt::format_to;
 using ::fmt::formatter;
+using ::fmt::make_format_args;
+using ::fmt::vformat;
 
 }  // namespace unrealsdk::fmt
 
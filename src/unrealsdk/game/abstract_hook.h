@@ -48,6 +48,9 @@ struct AbstractHook {
     virtual void process_event(unreal::UObject* object,
                                unreal::UFunction* func,
                                void* params) const = 0;
+    [[nodiscard]] virtual bool call_native(unreal::UObject* object,
+                                           unreal::UFunction* func,
+                                           void* params) const = 0;
     [[nodiscard]] virtual unreal::UObject* construct_object(
         unreal::UClass* cls,
         unreal::UObject* outer,
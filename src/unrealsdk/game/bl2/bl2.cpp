@@ -61,7 +61,7 @@ const constinit Pattern<23> FNAME_INIT_SIG{
 
 void BL2Hook::find_fname_init(void) {
     this->fname_init_ptr = FNAME_INIT_SIG.sigscan<void*>();
-    LOG(MISC, "FName::Init: {:p}", this->fname_init_ptr);
+    LOG(DEV_WARNING, "FName::Init: {:p}", this->fname_init_ptr);
 }
 
 void BL2Hook::fname_init(FName* name, const wchar_t* str, int32_t number) const {
@@ -93,7 +93,7 @@ const constinit Pattern<9> FFRAME_STEP_SIG{
 
 void BL2Hook::find_fframe_step(void) {
     fframe_step_ptr = FFRAME_STEP_SIG.sigscan<fframe_step_func>();
-    LOG(MISC, "FFrame::Step: {:p}", reinterpret_cast<void*>(fframe_step_ptr));
+    LOG(DEV_WARNING, "FFrame::Step: {:p}", reinterpret_cast<void*>(fframe_step_ptr));
 }
 void BL2Hook::fframe_step(FFrame* frame, UObject* obj, void* param) const {
     fframe_step_ptr(frame, obj, param);
@@ -98,6 +98,9 @@ class BL2Hook : public AbstractHook {
     void process_event(unreal::UObject* object,
                        unreal::UFunction* func,
                        void* params) const override;
+    [[nodiscard]] bool call_native(unreal::UObject* object,
+                                   unreal::UFunction* func,
+                                   void* params) const override;
     [[nodiscard]] unreal::UObject* construct_object(unreal::UClass* cls,
                                                     unreal::UObject* outer,
                                                     const unreal::FName& name,
@@ -44,7 +44,7 @@ void BL2Hook::hexedit_set_command(void) {
     if (set_command == nullptr) {
         LOG(ERROR, "Couldn't find set command signature");
     } else {
-        LOG(MISC, "Set Command: {:p}", reinterpret_cast<void*>(set_command));
+        LOG(DEV_WARNING, "Set Command: {:p}", reinterpret_cast<void*>(set_command));
 
         // NOLINTBEGIN(readability-magic-numbers)
         unlock_range(set_command, 2);
@@ -59,7 +59,7 @@ void BL2Hook::hexedit_array_limit(void) {
     if (array_limit == nullptr) {
         LOG(ERROR, "Couldn't find array limit signature");
     } else {
-        LOG(MISC, "Array Limit: {:p}", reinterpret_cast<void*>(array_limit));
+        LOG(DEV_WARNING, "Array Limit: {:p}", reinterpret_cast<void*>(array_limit));
 
         // NOLINTBEGIN(readability-magic-numbers)
         unlock_range(array_limit, 1);
@@ -73,7 +73,7 @@ void BL2Hook::hexedit_array_limit_message(void) const {
     if (array_limit_msg == nullptr) {
         LOG(ERROR, "Couldn't find array limit message signature");
     } else {
-        LOG(MISC, "Array Limit Message: {:p}", reinterpret_cast<void*>(array_limit_msg));
+        LOG(DEV_WARNING, "Array Limit Message: {:p}", reinterpret_cast<void*>(array_limit_msg));
 
         // NOLINTBEGIN(readability-magic-numbers)
         unlock_range(array_limit_msg, 6);
@@ -69,9 +69,12 @@ void __fastcall process_event_hook(UObject* obj,
         auto data = hook_manager::impl::preprocess_hook("ProcessEvent", func, obj);
         if (data != nullptr) {
             // Copy args so that hooks can't modify them, for parity with call function
-            const WrappedStruct args_base{func, params};
-            WrappedStruct args = args_base.copy_params_only();
-            hook_manager::Details hook{obj, &args, {func->find_return_param()}, {func, obj}};
+            std::optional<WrappedStruct> args{};
+            if (hook_manager::impl::needs_args(*data)) {
+                args = WrappedStruct{func, params}.copy_params_only();
+            }
+            hook_manager::Details hook{obj, args.has_value() ? &*args : nullptr,
+                                       {func->find_return_param()}, {func, obj}};
 
             const bool block_execution =
                 hook_manager::impl::run_hooks_of_type(*data, hook_manager::Type::PRE, hook);
@@ -120,6 +123,12 @@ void BL2Hook::process_event(UObject* object, UFunction* func, void* params) cons
     process_event_hook(object, nullptr, func, params, nullptr);
 }
 
+bool BL2Hook::call_native(UObject* /*object*/, UFunction* /*func*/, void* /*params*/) const {
+    // We haven't mapped out enough of UE3's FFrame to safely build one ourselves, nor replicated
+    // all the checks ProcessEvent does before calling a native function
+    return false;
+}
+
 namespace {
 
 // NOLINTNEXTLINE(modernize-use-using)
@@ -148,15 +157,33 @@ void __fastcall call_function_hook(UObject* obj,
     try {
         auto data = hook_manager::impl::preprocess_hook("ProcessEvent", func, obj);
         if (data != nullptr) {
-            WrappedStruct args{func};
-            auto original_code = stack->extract_current_args(args);
+            // Args are owned by default, so hooks may keep them around. Only if every hook which
+            // reads them has promised not to keep them past the hook can they live on the stack.
+            std::optional<WrappedStruct> owned_args{};
+            std::optional<StackWrappedStruct> stack_args{};
+            WrappedStruct* args = nullptr;
+            if (hook_manager::impl::needs_owned_args(*data)) {
+                args = &owned_args.emplace(func, PooledAllocation{});
+            } else if (hook_manager::impl::needs_args(*data)) {
+                args = &stack_args.emplace(func).get();
+            }
+
+            auto original_code = stack->Code;
+            if (args != nullptr) {
+                original_code = stack->extract_current_args(*args);
+            }
 
-            hook_manager::Details hook{obj, &args, {func->find_return_param()}, {func, obj}};
+            hook_manager::Details hook{obj, args, {func->find_return_param()}, {func, obj}};
 
             const bool block_execution =
                 hook_manager::impl::run_hooks_of_type(*data, hook_manager::Type::PRE, hook);
 
             if (block_execution) {
+                // Even if no hooks wanted them, we still need to step over the args - reuse the
+                // same storage rather than putting a second struct on the stack
+                if (args == nullptr) {
+                    stack->extract_current_args(stack_args.emplace(func).get());
+                }
                 stack->Code++;
             } else {
                 stack->Code = original_code;
@@ -45,7 +45,7 @@ const constinit Pattern<8> GMALLOC_PATTERN{
 
 void BL2Hook::find_gmalloc(void) {
     gmalloc = *read_offset<FMalloc**>(GMALLOC_PATTERN.sigscan());
-    LOG(MISC, "GMalloc: {:p}", reinterpret_cast<void*>(gmalloc));
+    LOG(DEV_WARNING, "GMalloc: {:p}", reinterpret_cast<void*>(gmalloc));
 }
 void* BL2Hook::u_malloc(size_t len) const {
     auto ret = gmalloc->vftable->u_malloc(gmalloc, len, get_malloc_alignment(len));
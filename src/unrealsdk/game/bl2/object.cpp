@@ -56,7 +56,7 @@ const constinit Pattern<49> CONSTRUCT_OBJECT_PATTERN{
 
 void BL2Hook::find_construct_object(void) {
     construct_obj_ptr = CONSTRUCT_OBJECT_PATTERN.sigscan<construct_obj_func>();
-    LOG(MISC, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
+    LOG(DEV_WARNING, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
 }
 
 UObject* BL2Hook::construct_object(UClass* cls,
@@ -145,7 +145,7 @@ const constinit Pattern<46> LOAD_PACKAGE_PATTERN{
 
 void BL2Hook::find_load_package(void) {
     load_package_ptr = LOAD_PACKAGE_PATTERN.sigscan<load_package_func>();
-    LOG(MISC, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
+    LOG(DEV_WARNING, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
 }
 
 [[nodiscard]] UObject* BL2Hook::load_package(const std::wstring& name, uint32_t flags) const {
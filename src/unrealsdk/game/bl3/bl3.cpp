@@ -56,7 +56,7 @@ const constinit Pattern<15> FNAME_INIT_PATTERN{
 
 void BL3Hook::find_fname_init(void) {
     fname_init_ptr = FNAME_INIT_PATTERN.sigscan<fname_init_func>();
-    LOG(MISC, "FName::Init: {:p}", reinterpret_cast<void*>(fname_init_ptr));
+    LOG(DEV_WARNING, "FName::Init: {:p}", reinterpret_cast<void*>(fname_init_ptr));
 }
 
 void BL3Hook::fname_init(FName* name, const wchar_t* str, int32_t number) const {
@@ -82,7 +82,7 @@ const constinit Pattern<10> FFRAME_STEP_SIG{
 
 void BL3Hook::find_fframe_step(void) {
     fframe_step_ptr = FFRAME_STEP_SIG.sigscan<fframe_step_func>();
-    LOG(MISC, "FFrame::Step: {:p}", reinterpret_cast<void*>(fframe_step_ptr));
+    LOG(DEV_WARNING, "FFrame::Step: {:p}", reinterpret_cast<void*>(fframe_step_ptr));
 }
 void BL3Hook::fframe_step(FFrame* frame, UObject* obj, void* param) const {
     fframe_step_ptr(frame, obj, param);
@@ -144,7 +144,7 @@ const constinit Pattern<131> FTEXT_AS_CULTURE_INVARIANT_PATTERN{
 void BL3Hook::find_ftext_as_culture_invariant(void) {
     ftext_as_culture_invariant_ptr =
         FTEXT_AS_CULTURE_INVARIANT_PATTERN.sigscan<ftext_as_culture_invariant_func>();
-    LOG(MISC, "FText::AsCultureInvariant: {:p}", reinterpret_cast<void*>(fname_init_ptr));
+    LOG(DEV_WARNING, "FText::AsCultureInvariant: {:p}", reinterpret_cast<void*>(fname_init_ptr));
 }
 
 // This is fine, since we consume it when calling the native function
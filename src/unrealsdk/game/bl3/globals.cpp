@@ -28,7 +28,7 @@ const constinit Pattern<26> GOBJECTS_SIG{
 
 void BL3Hook::find_gobjects(void) {
     auto gobjects_ptr = read_offset<GObjects::internal_type>(GOBJECTS_SIG.sigscan());
-    LOG(MISC, "GObjects: {:p}", reinterpret_cast<void*>(gobjects_ptr));
+    LOG(DEV_WARNING, "GObjects: {:p}", reinterpret_cast<void*>(gobjects_ptr));
 
     gobjects_wrapper = GObjects(gobjects_ptr);
 }
@@ -56,7 +56,7 @@ const constinit Pattern<27> GNAMES_SIG{
 
 void BL3Hook::find_gnames(void) {
     auto gnames_ptr = *read_offset<GNames::internal_type*>(GNAMES_SIG.sigscan());
-    LOG(MISC, "GNames: {:p}", reinterpret_cast<void*>(gnames_ptr));
+    LOG(DEV_WARNING, "GNames: {:p}", reinterpret_cast<void*>(gnames_ptr));
 
     gnames_wrapper = GNames(gnames_ptr);
 }
@@ -57,9 +57,9 @@ void BL3Hook::find_gmalloc(void) {
     fmemory_realloc_ptr = REALLOC_PATTERN.sigscan<fmemory_realloc_func>();
     fmemory_free_ptr = FREE_PATTERN.sigscan<fmemory_free_func>();
 
-    LOG(MISC, "FMemory::Malloc: {:p}", reinterpret_cast<void*>(fmemory_malloc_ptr));
-    LOG(MISC, "FMemory::Realloc: {:p}", reinterpret_cast<void*>(fmemory_realloc_ptr));
-    LOG(MISC, "FMemory::Free: {:p}", reinterpret_cast<void*>(fmemory_free_ptr));
+    LOG(DEV_WARNING, "FMemory::Malloc: {:p}", reinterpret_cast<void*>(fmemory_malloc_ptr));
+    LOG(DEV_WARNING, "FMemory::Realloc: {:p}", reinterpret_cast<void*>(fmemory_realloc_ptr));
+    LOG(DEV_WARNING, "FMemory::Free: {:p}", reinterpret_cast<void*>(fmemory_free_ptr));
 }
 void* BL3Hook::u_malloc(size_t len) const {
     auto ret = fmemory_malloc_ptr(len, get_malloc_alignment(len));
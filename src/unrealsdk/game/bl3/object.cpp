@@ -49,7 +49,7 @@ const constinit Pattern<55> CONSTRUCT_OBJECT_PATTERN{
 
 void BL3Hook::find_construct_object(void) {
     construct_obj_ptr = CONSTRUCT_OBJECT_PATTERN.sigscan<construct_obj_func>();
-    LOG(MISC, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
+    LOG(DEV_WARNING, "StaticConstructObject: {:p}", reinterpret_cast<void*>(construct_obj_ptr));
 }
 
 UObject* BL3Hook::construct_object(UClass* cls,
@@ -85,7 +85,7 @@ const constinit Pattern<21> GET_PATH_NAME_PATTERN{
 
 void BL3Hook::find_get_path_name(void) {
     get_path_name_ptr = GET_PATH_NAME_PATTERN.sigscan<get_path_name_func>();
-    LOG(MISC, "GetPathName: {:p}", reinterpret_cast<void*>(get_path_name_ptr));
+    LOG(DEV_WARNING, "GetPathName: {:p}", reinterpret_cast<void*>(get_path_name_ptr));
 }
 
 std::wstring BL3Hook::uobject_path_name(const UObject* obj) const {
@@ -121,7 +121,7 @@ const constexpr intptr_t ANY_PACKAGE = -1;
 
 void BL3Hook::find_static_find_object(void) {
     static_find_object_ptr = STATIC_FIND_OBJECT_PATTERN.sigscan<static_find_object_safe_func>();
-    LOG(MISC, "StaticFindObjectSafe: {:p}", reinterpret_cast<void*>(static_find_object_ptr));
+    LOG(DEV_WARNING, "StaticFindObjectSafe: {:p}", reinterpret_cast<void*>(static_find_object_ptr));
 }
 
 UObject* BL3Hook::find_object(UClass* cls, const std::wstring& name) const {
@@ -153,7 +153,7 @@ const constinit Pattern<16> LOAD_PACKAGE_PATTERN{
 
 void BL3Hook::find_load_package(void) {
     load_package_ptr = LOAD_PACKAGE_PATTERN.sigscan<load_package_func>();
-    LOG(MISC, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
+    LOG(DEV_WARNING, "LoadPackage: {:p}", reinterpret_cast<void*>(load_package_ptr));
 }
 
 [[nodiscard]] UObject* BL3Hook::load_package(const std::wstring& name, uint32_t flags) const {
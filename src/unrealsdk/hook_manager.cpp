@@ -14,13 +14,22 @@ namespace unrealsdk::hook_manager {
 
 namespace impl {
 
-using Group = utils::StringViewMap<std::wstring, DLLSafeCallback*>;
+struct Hook {
+    DLLSafeCallback* callback;
+    ArgsUsage args_usage;
+};
+
+using Group = utils::StringViewMap<std::wstring, Hook>;
 
 struct List {
     Group pre;
     Group post;
     Group post_unconditional;
 
+    // How many hooks in this list use the call's args, in each way
+    size_t owned_arg_users;
+    size_t scoped_arg_users;
+
     /**
      * @brief Checks if all groups in the list are empty.
      *
@@ -90,23 +99,25 @@ void inject_next_call(void) {
 
 #ifdef UNREALSDK_SHARED
 UNREALSDK_CAPI(bool,
-               add_hook,
+               add_hook_ex,
                const wchar_t* func,
                size_t func_size,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size,
-               DLLSafeCallback* callback);
+               DLLSafeCallback* callback,
+               ArgsUsage args_usage);
 #endif
 #ifndef UNREALSDK_IMPORTING
 UNREALSDK_CAPI(bool,
-               add_hook,
+               add_hook_ex,
                const wchar_t* func,
                size_t func_size,
                Type type,
                const wchar_t* identifier,
                size_t identifier_size,
-               DLLSafeCallback* callback) {
+               DLLSafeCallback* callback,
+               ArgsUsage args_usage) {
     const std::wstring_view func_view{func, func_size};
     auto iter = hooks.find(func_view);
     if (iter == hooks.end()) {
@@ -120,11 +131,46 @@ UNREALSDK_CAPI(bool,
         return false;
     }
 
-    group.emplace(identifier_view, callback);
+    group.emplace(identifier_view, impl::Hook{.callback = callback, .args_usage = args_usage});
+    switch (args_usage) {
+        case ArgsUsage::OWNED:
+            iter->second.owned_arg_users++;
+            break;
+        case ArgsUsage::HOOK_SCOPED:
+            iter->second.scoped_arg_users++;
+            break;
+        case ArgsUsage::UNUSED:
+            break;
+    }
     return true;
 }
 #endif
 
+// Kept with it's original signature, for plugins built against older versions
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool,
+               add_hook,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback* callback);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool,
+               add_hook,
+               const wchar_t* func,
+               size_t func_size,
+               Type type,
+               const wchar_t* identifier,
+               size_t identifier_size,
+               DLLSafeCallback* callback) {
+    return UNREALSDK_MANGLE(add_hook_ex)(func, func_size, type, identifier, identifier_size,
+                                         callback, ArgsUsage::OWNED);
+}
+#endif
+
 bool add_hook(std::wstring_view func,
               Type type,
               std::wstring_view identifier,
@@ -135,6 +181,18 @@ bool add_hook(std::wstring_view func,
     // NOLINTEND(cppcoreguidelines-owning-memory)
 }
 
+bool add_hook(std::wstring_view func,
+              Type type,
+              std::wstring_view identifier,
+              const Callback& callback,
+              ArgsUsage args_usage) {
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+    return UNREALSDK_MANGLE(add_hook_ex)(func.data(), func.size(), type, identifier.data(),
+                                         identifier.size(), new DLLSafeCallback(callback),
+                                         args_usage);
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+}
+
 #ifdef UNREALSDK_SHARED
 UNREALSDK_CAPI(bool,
                has_hook,
@@ -202,7 +260,17 @@ UNREALSDK_CAPI(bool,
         return false;
     }
 
-    group_iter->second->destroy();
+    switch (group_iter->second.args_usage) {
+        case ArgsUsage::OWNED:
+            func_iter->second.owned_arg_users--;
+            break;
+        case ArgsUsage::HOOK_SCOPED:
+            func_iter->second.scoped_arg_users--;
+            break;
+        case ArgsUsage::UNUSED:
+            break;
+    }
+    group_iter->second.callback->destroy();
     group.erase(group_iter);
 
     /*
@@ -237,9 +305,9 @@ const List* preprocess_hook(std::string_view source, const UFunction* func, cons
     auto func_name = func->get_path_name();
 
     if (should_log_all_calls) {
-        LOG(MISC, "===== {} called =====", source);
-        LOG(MISC, L"Function: {}", func_name);
-        LOG(MISC, L"Object: {}", obj->get_path_name());
+        LOG(DEV_WARNING, "===== {} called =====", source);
+        LOG(DEV_WARNING, L"Function: {}", func_name);
+        LOG(DEV_WARNING, L"Object: {}", obj->get_path_name());
     }
 
     if (!hooks.contains(func_name)) {
@@ -261,6 +329,14 @@ bool has_post_hooks(const List& list) {
     return !list.post.empty() || !list.post_unconditional.empty();
 }
 
+bool needs_args(const List& list) {
+    return list.owned_arg_users > 0 || list.scoped_arg_users > 0;
+}
+
+bool needs_owned_args(const List& list) {
+    return list.owned_arg_users > 0;
+}
+
 bool run_hooks_of_type(const List& list, Type type, Details& hook) {
     // Grab a copy of the revelevant hook group, incase the hook removes itself (which would
     // invalidate the iterator)
@@ -286,7 +362,7 @@ bool run_hooks_of_type(const List& list, Type type, Details& hook) {
     bool ret = false;
     for (const auto& [_, hook_function] : group) {
         try {
-            ret |= hook_function->operator()(hook);
+            ret |= hook_function.callback->operator()(hook);
         } catch (const std::exception& ex) {
             LOG(ERROR, "An exception occurred during hook processing: {}", ex.what());
         }
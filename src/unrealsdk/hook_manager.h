@@ -24,6 +24,13 @@ enum class Type : uint8_t {
     POST_UNCONDITIONAL,  /// After the hooked function, even if it got blocked.
 };
 
+/// How a hook uses the call's args
+enum class ArgsUsage : uint8_t {
+    OWNED,        /// Reads the args, and may keep them (or values from them) after returning.
+    HOOK_SCOPED,  /// Reads the args, but never keeps anything from them past returning.
+    UNUSED,       /// Never reads the args.
+};
+
 /// Information about a hooked function call
 struct Details {
     /// The object the hooked function was called on.
@@ -31,6 +38,10 @@ struct Details {
 
     /// The arguments the hooked function was called with. While this is mutable, modifying it will
     /// *not* modify the actual function arguments.
+    /// If every hook on the function which reads the args was added with `ArgsUsage::HOOK_SCOPED`,
+    /// this may be stored on the stack, in which case it, and anything retrieved from it, is only
+    /// valid until the hook returns. If every hook was added with `ArgsUsage::UNUSED`, this will be
+    /// null.
     unreal::WrappedStruct* args{};
 
     /// A proxy for the return value. During pre-hooks, it's an unset value, and setting it will
@@ -78,12 +89,19 @@ void inject_next_call(void);
  * @param type Which type of hook to add.
  * @param identifier The hook identifier.
  * @param callback The callback to run when the hooked function is called.
+ * @param args_usage How the callback uses the call's args. If no hooks on a function read them,
+ *                   extracting them may be skipped entirely. Defaults to `ArgsUsage::OWNED`.
  * @return True if successfully added, false if an identical hook already existed.
  */
 bool add_hook(std::wstring_view func,
               Type type,
               std::wstring_view identifier,
               const Callback& callback);
+bool add_hook(std::wstring_view func,
+              Type type,
+              std::wstring_view identifier,
+              const Callback& callback,
+              ArgsUsage args_usage);
 
 /**
  * @brief Checks if a hook exists.
@@ -125,7 +143,9 @@ is, it returns the list of hooks, to be passed to the next step.
 If there is a hook, calling code can then spend more time retrieving the remaining information,
 before calling `run_hooks_of_type` using pre-hooks. This actually runs all the hooks, and returns
 the logical or of their return values. It can then run the unreal function or block execution as
-required.
+required. Since extracting args is typically the most expensive part, `needs_args` can be used to
+skip it when none of the hooks will read them, and `needs_owned_args` to check if they may be stored
+on the stack.
 
 Extracting the return value may not be trivial either, so the calling code can run `has_post_hooks`
 to work out if to early exit again. If it does, it can spend a bit longer extracting it, then call
@@ -152,6 +172,24 @@ const List* preprocess_hook(std::string_view source,
  */
 bool has_post_hooks(const List& list);
 
+/**
+ * @brief Checks if any hooks in a list use the call's args.
+ * @note If this returns false, calling code may set `Details::args` to null.
+ *
+ * @param list The hook list, retrieved from `preprocess_hook`.
+ * @return True if args need to be extracted.
+ */
+bool needs_args(const List& list);
+
+/**
+ * @brief Checks if any hooks in a list may keep the call's args past the end of the hook.
+ * @note If this returns false, calling code may store the args on the stack.
+ *
+ * @param list The hook list, retrieved from `preprocess_hook`.
+ * @return True if args need to be extracted into owned memory.
+ */
+bool needs_owned_args(const List& list);
+
 /**
  * @brief Runs all the hooks in a list which match the given type.
  *
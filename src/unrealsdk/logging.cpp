@@ -1,5 +1,6 @@
 #include "unrealsdk/pch.h"
 
+#include "unrealsdk/deferred_log.h"
 #include "unrealsdk/env.h"
 #include "unrealsdk/logging.h"
 #include "unrealsdk/unrealsdk.h"
@@ -7,18 +8,35 @@
 
 namespace unrealsdk::logging {
 
+#ifndef UNREALSDK_IMPORTING
+namespace impl {
+
+// Strictly speaking, std::atomic is not guaranteed to be safe to cross dll boundaries, but if it's
+// lock free it's implemented in hardware, so in practice it is
+static_assert(std::atomic<Level>::is_always_lock_free
+                  && sizeof(std::atomic<Level>) == sizeof(Level),
+              "atomic level may not be safe to cross dll boundaries");
+std::atomic<Level> min_level{Level::MIN};
+
+}  // namespace impl
+#endif
+
 namespace {
 
 #ifndef UNREALSDK_IMPORTING
 std::mutex mutex{};
 
 Level unreal_console_level = Level::DEFAULT_CONSOLE_LEVEL;
+
 HANDLE external_console_handle = nullptr;
 std::unique_ptr<std::ostream> log_file_stream;
 
 std::vector<log_callback> all_log_callbacks{};
 
 bool callbacks_only = false;
+
+// Set while flushing messages during static destruction
+bool shutting_down = false;
 #endif
 
 /**
@@ -101,7 +119,7 @@ std::string truncate_leading_chunks(const std::string&& str,
  * @param level The log level
  * @return The level's name.
  */
-std::string get_level_name(Level level) {
+constexpr std::string_view get_level_name(Level level) {
     switch (level) {
         default:
         case Level::ERROR:
@@ -123,18 +141,65 @@ constexpr auto LOCATION_WIDTH = 50;
 constexpr auto LINE_WIDTH = 4;
 constexpr auto LEVEL_WIDTH = 4;
 
+// Locations aren't necessarily static, so we may keep seeing new ones, make sure we stay bounded
+const constexpr size_t MAX_CACHED_LOCATIONS = 4096;
+
+/**
+ * @brief Creates the truncated and padded form of a location, as it appears in the log.
+ *
+ * @param location The location.
+ * @return The location prefix.
+ */
+std::string make_location_prefix(const char* location) {
+    return unrealsdk::fmt::format(
+        "{1:>{0}}", LOCATION_WIDTH,
+        truncate_leading_chunks(std::string{location}, "\\/:", LOCATION_WIDTH));
+}
+
+/**
+ * @brief Gets the truncated and padded form of a location, as it appears in the log, via a cache.
+ * @note The returned reference is only valid until the next call on the same thread.
+ *
+ * @param location The location.
+ * @return The location prefix.
+ */
+const std::string& get_location_prefix(const char* location) {
+    // Locations are string literals, which we keep the original pointer to throughout, so we can
+    // cache on just the pointer, and avoid re-truncating the same location every time.
+    // Cached per thread, so that we don't need to synchronize between the writer threads.
+    thread_local std::unordered_map<const char*, std::string> cache{};
+
+    auto iter = cache.find(location);
+    if (iter != cache.end()) {
+        return iter->second;
+    }
+
+    if (cache.size() >= MAX_CACHED_LOCATIONS) {
+        cache.clear();
+    }
+
+    return cache.emplace(location, make_location_prefix(location)).first->second;
+}
+
 /**
  * @brief Formats a log message following our internal style.
  *
+ * @param out The string to append the formatted message to.
  * @param msg The log message.
- * @return The formatted message
  */
-std::string format_message(const LogMessage& msg) {
-    return unrealsdk::fmt::format(
-        "{1:>{0}%F %T}Z {3:>{2}}@{5:<{4}d} {7:>{6}}| {8}\n", DATE_WIDTH + 1 + TIME_WIDTH + 1,
-        time_from_unix_ms(msg.unix_time_ms), LOCATION_WIDTH,
-        truncate_leading_chunks(msg.location, "\\/:", LOCATION_WIDTH), LINE_WIDTH, msg.line,
-        LEVEL_WIDTH, get_level_name(msg.level), std::string{msg.msg, msg.msg_size});
+void format_message(std::string& out, const LogMessage& msg) {
+    // The thread local cache may have already been destroyed by the time we flush on shutdown
+    std::string uncached_prefix{};
+    if (shutting_down) {
+        uncached_prefix = make_location_prefix(msg.location);
+    }
+    const auto& prefix = shutting_down ? uncached_prefix : get_location_prefix(msg.location);
+
+    unrealsdk::fmt::format_to(std::back_inserter(out),
+                              "{1:>{0}%F %T}Z {2}@{4:<{3}d} {6:>{5}}| {7}\n",
+                              DATE_WIDTH + 1 + TIME_WIDTH + 1, time_from_unix_ms(msg.unix_time_ms),
+                              prefix, LINE_WIDTH, msg.line, LEVEL_WIDTH, get_level_name(msg.level),
+                              std::string_view{msg.msg, msg.msg_size});
 }
 
 /**
@@ -196,6 +261,791 @@ Level get_level_from_string(std::string_view str) {
 
 }  // namespace
 
+#pragma region Async Logging
+
+namespace {
+
+#ifndef UNREALSDK_IMPORTING
+
+/*
+Formatting messages and writing them to the log file/external console is relatively slow, and would
+otherwise be done on whatever thread logged the message - usually the game thread.
+
+In async mode, messages are instead copied into a bounded lock-free queue, and a background thread
+periodically takes them all, formats them, and writes them out in one batch. The log file is only
+flushed once it's caught up, or every so often if it never does. If the queue fills up, new
+messages are dropped (and counted), so memory usage stays bounded. Errors are always written
+synchronously, after flushing everything before them, so they make it out even if we're about to
+crash.
+
+The queue is a multi-producer ring buffer with a sequence number in each slot. The consumer side is
+guarded by a mutex, so only one thread ever drains it at once. Slots keep their string buffers
+between uses, so after warming up, queuing a message usually doesn't allocate.
+*/
+
+struct QueuedMessage {
+    std::atomic<size_t> sequence;
+
+    uint64_t unix_time_ms;
+    Level level;
+    std::string msg;
+    const char* location;
+    int line;
+};
+
+const constexpr auto ASYNC_WRITE_INTERVAL = std::chrono::milliseconds{10};
+const constexpr auto ASYNC_FLUSH_INTERVAL = std::chrono::milliseconds{1000};
+// How long to wait for the writer thread to finish it's current batch on shutdown
+const constexpr auto ASYNC_SHUTDOWN_TIMEOUT = std::chrono::milliseconds{100};
+
+bool async_logging = false;
+std::atomic<bool> stop_async_writer{false};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+std::unique_ptr<QueuedMessage[]> queue;
+size_t queue_mask = 0;
+std::atomic<size_t> enqueue_pos{0};
+std::atomic<size_t> dropped_messages{0};
+
+std::timed_mutex write_mutex{};
+size_t dequeue_pos = 0;
+bool log_file_needs_flush = false;
+
+/**
+ * @brief Writes a formatted message to the external console and log file.
+ * @note Does not flush the log file.
+ *
+ * @param formatted The formatted message.
+ */
+void write_formatted(const std::string& formatted) {
+    if (external_console_handle != nullptr) {
+        WriteFile(external_console_handle, formatted.c_str(), (DWORD)formatted.size(), nullptr,
+                  nullptr);
+    }
+
+    if (log_file_stream) {
+        *log_file_stream << formatted;
+    }
+}
+
+/**
+ * @brief Flushes the log file.
+ */
+void flush_log_file(void) {
+    if (log_file_stream) {
+        log_file_stream->flush();
+    }
+}
+
+/**
+ * @brief Tries to add a message to the async queue.
+ *
+ * @param msg The message to add.
+ * @return True if the message was added, false if the queue was full.
+ */
+bool try_enqueue(const LogMessage& msg) {
+    auto pos = enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = queue[pos & queue_mask];
+        auto seq = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.unix_time_ms = msg.unix_time_ms;
+                slot.level = msg.level;
+                slot.msg.assign(msg.msg, msg.msg_size);
+                slot.location = msg.location;
+                slot.line = msg.line;
+
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The consumer hasn't freed this slot yet, we're full
+            return false;
+        } else {
+            // Another producer took this slot, try the next
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Checks if the next message in the queue is ready to be written.
+ * @note Must be holding the write mutex.
+ *
+ * @return True if there's a message to write.
+ */
+bool queue_has_ready_message(void) {
+    return queue[dequeue_pos & queue_mask].sequence.load(std::memory_order_acquire)
+           == dequeue_pos + 1;
+}
+
+/**
+ * @brief Formats and writes all queued messages.
+ * @note Must be holding the write mutex.
+ * @note Leaves flushing the log file to the caller.
+ */
+void drain_queue(void) {
+    std::string batch{};
+
+    while (queue_has_ready_message()) {
+        auto& slot = queue[dequeue_pos & queue_mask];
+        format_message(batch, {slot.unix_time_ms, slot.level, slot.msg.data(), slot.msg.size(),
+                               slot.location, slot.line});
+
+        slot.sequence.store(dequeue_pos + queue_mask + 1, std::memory_order_release);
+        dequeue_pos++;
+    }
+
+    auto dropped = dropped_messages.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        auto dropped_msg = unrealsdk::fmt::format("Dropped {} log messages", dropped);
+        format_message(batch, {unix_ms_now(), Level::WARNING, dropped_msg.data(),
+                               dropped_msg.size(), (const char*)(__FUNCTION__), __LINE__});
+    }
+
+    if (!batch.empty()) {
+        write_formatted(batch);
+        log_file_needs_flush = true;
+    }
+}
+
+/**
+ * @brief Thread which periodically writes out all queued messages.
+ */
+void async_writer_thread(void) {
+    auto last_flush = std::chrono::steady_clock::now();
+
+    while (!stop_async_writer.load(std::memory_order_acquire)) {
+        {
+            const std::lock_guard<std::timed_mutex> lock(write_mutex);
+            drain_queue();
+
+            // Only flush once we've caught up, or periodically if we never do, rather than after
+            // every batch
+            auto now = std::chrono::steady_clock::now();
+            if (log_file_needs_flush
+                && (!queue_has_ready_message() || now - last_flush >= ASYNC_FLUSH_INTERVAL)) {
+                flush_log_file();
+                log_file_needs_flush = false;
+                last_flush = now;
+            }
+        }
+        std::this_thread::sleep_for(ASYNC_WRITE_INTERVAL);
+    }
+}
+
+/**
+ * @brief Switches to async logging.
+ *
+ * @param queue_size The minimum amount of messages which may be queued at once.
+ */
+void start_async_logging(size_t queue_size) {
+    auto size = std::bit_ceil(std::max<size_t>(queue_size, 2));
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    queue = std::make_unique<QueuedMessage[]>(size);
+    queue_mask = size - 1;
+    for (size_t i = 0; i < size; i++) {
+        queue[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    async_logging = true;
+
+    // Detached, since we can't join threads during dll unload
+    std::thread{async_writer_thread}.detach();
+}
+
+/**
+ * @brief Writes out any messages still left in the queue on shutdown.
+ */
+struct AsyncShutdownFlusher {
+    AsyncShutdownFlusher(void) = default;
+    AsyncShutdownFlusher(const AsyncShutdownFlusher&) = delete;
+    AsyncShutdownFlusher(AsyncShutdownFlusher&&) = delete;
+    AsyncShutdownFlusher& operator=(const AsyncShutdownFlusher&) = delete;
+    AsyncShutdownFlusher& operator=(AsyncShutdownFlusher&&) = delete;
+
+    ~AsyncShutdownFlusher(void) {
+        if (!async_logging) {
+            return;
+        }
+        shutting_down = true;
+        stop_async_writer.store(true, std::memory_order_release);
+
+        // If the writer thread's still alive, it will release the mutex once it finishes it's
+        // current batch, and then exit. By the time we're being destroyed it's more likely to have
+        // already been killed however, possibly while holding the mutex, in which case nothing else
+        // can be touching the queue, so drain it regardless.
+        const std::unique_lock<std::timed_mutex> lock(write_mutex, ASYNC_SHUTDOWN_TIMEOUT);
+        drain_queue();
+        flush_log_file();
+    }
+} async_shutdown_flusher{};
+
+/**
+ * @brief Formats a log message into a reusable per thread buffer, writes it, and flushes the log
+ *        file.
+ *
+ * @param msg The message to write.
+ */
+void format_and_write(const LogMessage& msg) {
+    if (shutting_down) {
+        std::string formatted{};
+        format_message(formatted, msg);
+        write_formatted(formatted);
+        flush_log_file();
+        return;
+    }
+
+    // Reuse the same buffer to avoid allocating for every message
+    thread_local std::string buffer{};
+    buffer.clear();
+    format_message(buffer, msg);
+    write_formatted(buffer);
+    flush_log_file();
+}
+
+/**
+ * @brief Writes a log message to the external console and log file, either directly, or by queuing
+ *        it for the async writer.
+ *
+ * @param msg The message to write.
+ */
+void write_message(const LogMessage& msg) {
+    if (external_console_handle == nullptr && !log_file_stream) {
+        return;
+    }
+
+    if (!async_logging) {
+        format_and_write(msg);
+        return;
+    }
+
+    // Flush everything before errors, and write them synchronously
+    if (msg.level >= Level::ERROR) {
+        const std::lock_guard<std::timed_mutex> lock(write_mutex);
+        drain_queue();
+        format_and_write(msg);
+        log_file_needs_flush = false;
+        return;
+    }
+
+    if (!try_enqueue(msg)) {
+        dropped_messages.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+#endif
+
+}  // namespace
+
+#pragma endregion
+
+#pragma region Rate Limiting
+
+namespace {
+
+#ifndef UNREALSDK_IMPORTING
+
+/*
+To stop something which is repeatedly failing (e.g. every time a hook runs) from flooding the log,
+and tanking performance while it's at it, each call site gets rate limited.
+
+Firstly, if a call site logs the exact same message again within a short window, it's suppressed,
+and we just count how many times it was repeated. Secondly, each call site has a token bucket,
+limiting how many messages it may log per second, with some allowance for short bursts. Once a call
+site gets to log again, we prefix it with a summary of what was skipped. If it never logs again, the
+summary is instead written once it's gone quiet for a while, or on dumping deferred records, or on
+shutdown.
+
+By default only warnings and errors are limited. Lower levels include intentional output, such as
+scripts printing to console, or debug output like `log_all_calls`, which we don't want to lose.
+*/
+
+struct CallSite {
+    const char* location;
+    int line;
+
+    bool operator==(const CallSite& other) const = default;
+};
+
+struct CallSiteHash {
+    size_t operator()(const CallSite& site) const {
+        return std::hash<const char*>{}(site.location) ^ std::hash<int>{}(site.line);
+    }
+};
+
+struct CallSiteState {
+    double tokens;
+    std::chrono::steady_clock::time_point last_refill;
+    size_t rate_limited;
+
+    std::string last_msg;
+    std::chrono::steady_clock::time_point last_msg_time;
+    size_t repeats;
+
+    Level suppressed_level;
+    std::chrono::steady_clock::time_point last_suppressed_time;
+};
+
+// Locations aren't necessarily static, so we may keep seeing new ones, make sure we stay bounded
+const constexpr size_t MAX_TRACKED_CALL_SITES = 4096;
+
+// How long a call site must go without suppressing anything before we write it's pending summary
+const constexpr std::chrono::milliseconds SUMMARY_DELAY{1000};
+
+std::mutex rate_limit_mutex{};
+std::unordered_map<CallSite, CallSiteState, CallSiteHash> call_sites{};
+
+Level rate_limit_level = Level::WARNING;
+double rate_limit = env::defaults::LOG_RATE_LIMIT;
+double rate_limit_burst = env::defaults::LOG_RATE_LIMIT_BURST;
+std::chrono::milliseconds duplicate_window{env::defaults::LOG_DUPLICATE_WINDOW};
+
+std::atomic<std::chrono::steady_clock::rep> next_summary_sweep{0};
+
+/**
+ * @brief Checks if rate limiting is enabled at all.
+ *
+ * @return True if rate limiting is enabled.
+ */
+bool rate_limiting_enabled(void) {
+    return rate_limit > 0 || duplicate_window.count() > 0;
+}
+
+/**
+ * @brief Takes the summary of what a call site has suppressed, resetting it's counters.
+ *
+ * @param site The call site's state. Must be holding the rate limit mutex.
+ * @return The summary, or an empty string if nothing was suppressed.
+ */
+std::string take_summary(CallSiteState& site) {
+    std::string summary{};
+    if (site.repeats > 0 && site.rate_limited > 0) {
+        summary = unrealsdk::fmt::format(
+            "Last message repeated {} times, and {} other messages were suppressed", site.repeats,
+            site.rate_limited);
+    } else if (site.repeats > 0) {
+        summary = unrealsdk::fmt::format("Last message repeated {} times", site.repeats);
+    } else if (site.rate_limited > 0) {
+        summary = unrealsdk::fmt::format("{} messages were suppressed", site.rate_limited);
+    }
+    site.repeats = 0;
+    site.rate_limited = 0;
+    site.suppressed_level = Level::MIN;
+    return summary;
+}
+
+/**
+ * @brief Checks if a message is allowed through the rate limits.
+ *
+ * @param msg The message to check.
+ * @param summary Output string, set to a summary of suppressed messages which should be logged
+ *                before this one, if any.
+ * @return True if the message should be logged.
+ */
+bool check_rate_limit(const LogMessage& msg, std::string& summary) {
+    if (msg.level < rate_limit_level || !rate_limiting_enabled()) {
+        return true;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    const std::string_view msg_view{msg.msg, msg.msg_size};
+
+    const std::lock_guard<std::mutex> lock(rate_limit_mutex);
+
+    if (call_sites.size() >= MAX_TRACKED_CALL_SITES) {
+        call_sites.clear();
+    }
+    auto [iter, inserted] = call_sites.try_emplace({.location = msg.location, .line = msg.line});
+    auto& site = iter->second;
+    if (inserted) {
+        site.tokens = rate_limit_burst;
+        site.last_refill = now;
+        site.suppressed_level = Level::MIN;
+    }
+
+    if (duplicate_window.count() > 0 && site.last_msg == msg_view
+        && now - site.last_msg_time < duplicate_window) {
+        site.repeats++;
+        site.suppressed_level = std::max(site.suppressed_level, msg.level);
+        site.last_suppressed_time = now;
+        return false;
+    }
+
+    if (rate_limit > 0) {
+        const std::chrono::duration<double> elapsed = now - site.last_refill;
+        site.tokens = std::min(rate_limit_burst, site.tokens + (elapsed.count() * rate_limit));
+        site.last_refill = now;
+
+        if (site.tokens < 1) {
+            site.rate_limited++;
+            site.suppressed_level = std::max(site.suppressed_level, msg.level);
+            site.last_suppressed_time = now;
+            return false;
+        }
+        site.tokens -= 1;
+    }
+
+    summary = take_summary(site);
+
+    site.last_msg = msg_view;
+    site.last_msg_time = now;
+
+    return true;
+}
+
+#endif
+
+}  // namespace
+
+#pragma endregion
+
+namespace {
+
+#ifndef UNREALSDK_IMPORTING
+
+/**
+ * @brief Outputs a log message to all callbacks and enabled outputs.
+ *
+ * @param msg The message to output.
+ */
+void output_message(const LogMessage& msg) {
+    // In async mode, only hold the lock for the parts which still need to be done synchronously
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (const auto& callback : all_log_callbacks) {
+        callback(&msg);
+    }
+
+    if (callbacks_only) {
+        return;
+    }
+
+    if (unreal_console_level <= msg.level) {
+        unrealsdk::uconsole_output_text(utils::widen({msg.msg, msg.msg_size}));
+    }
+
+    if (async_logging) {
+        lock.unlock();
+    }
+    write_message(msg);
+}
+
+/**
+ * @brief Writes the summaries of any call sites which suppressed messages, and have since gone
+ *        quiet.
+ *
+ * @param force If true, writes all pending summaries, even if the call site's still suppressing.
+ * @param shutdown If true, only writes to the log file and external console, since it's no longer
+ *                 safe to call callbacks or the unreal console.
+ */
+void flush_rate_limit_summaries(bool force, bool shutdown) {
+    struct PendingSummary {
+        Level level;
+        const char* location;
+        int line;
+        std::string summary;
+    };
+    std::vector<PendingSummary> pending{};
+
+    // Don't hold the lock while outputting, since callbacks may log themselves
+    {
+        auto now = std::chrono::steady_clock::now();
+        const std::lock_guard<std::mutex> lock(rate_limit_mutex);
+        for (auto& [site, state] : call_sites) {
+            if (state.repeats == 0 && state.rate_limited == 0) {
+                continue;
+            }
+            if (!force && now - state.last_suppressed_time < SUMMARY_DELAY) {
+                continue;
+            }
+            auto level = state.suppressed_level;
+            pending.push_back({.level = level,
+                               .location = site.location,
+                               .line = site.line,
+                               .summary = take_summary(state)});
+        }
+    }
+
+    for (const auto& entry : pending) {
+        const LogMessage msg{unix_ms_now(),        entry.level,    entry.summary.data(),
+                             entry.summary.size(), entry.location, entry.line};
+        if (shutdown) {
+            write_message(msg);
+        } else {
+            output_message(msg);
+        }
+    }
+}
+
+/**
+ * @brief Periodically writes pending rate limiting summaries.
+ */
+void maybe_flush_rate_limit_summaries(void) {
+    if (!rate_limiting_enabled()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto next = next_summary_sweep.load(std::memory_order_relaxed);
+    if (now < next) {
+        return;
+    }
+    auto delay =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(SUMMARY_DELAY).count();
+    // Only let one thread sweep at a time
+    if (!next_summary_sweep.compare_exchange_strong(next, now + delay,
+                                                    std::memory_order_relaxed)) {
+        return;
+    }
+
+    flush_rate_limit_summaries(false, false);
+}
+
+/**
+ * @brief Writes out any pending rate limiting summaries on shutdown.
+ */
+struct RateLimitShutdownFlusher {
+    RateLimitShutdownFlusher(void) = default;
+    RateLimitShutdownFlusher(const RateLimitShutdownFlusher&) = delete;
+    RateLimitShutdownFlusher(RateLimitShutdownFlusher&&) = delete;
+    RateLimitShutdownFlusher& operator=(const RateLimitShutdownFlusher&) = delete;
+    RateLimitShutdownFlusher& operator=(RateLimitShutdownFlusher&&) = delete;
+
+    ~RateLimitShutdownFlusher(void) {
+        // Destroyed before the async flusher, so anything we queue still gets written
+        shutting_down = true;
+        try {
+            flush_rate_limit_summaries(true, true);
+        } catch (...) {
+            // Nothing we can do about it this late
+        }
+    }
+} rate_limit_shutdown_flusher{};
+
+#endif
+
+}  // namespace
+
+#pragma region Deferred Logging
+
+namespace {
+
+#ifndef UNREALSDK_IMPORTING
+
+/*
+Deferred records are written into a ring buffer, which we simply let wrap around and overwrite the
+oldest records. Each slot is protected by a seqlock - writers make the sequence number odd while
+they're writing, and dumping re-checks it after copying a record out, so that it can skip any
+records which were overwritten while it was reading them.
+
+Writers claim a position before they start writing its slot, so dumping may reach a slot which
+hasn't been published yet. In this case it stops there, and resumes from that slot next time.
+*/
+
+struct DeferredRecordData {
+    size_t position;
+    uint64_t unix_time_ms;
+    Level level;
+    const char* format;
+    deferred_decoder decoder;
+    const char* location;
+    int line;
+    std::array<uint8_t, impl::DEFERRED_ARGS_SIZE> args;
+};
+
+struct DeferredRecord {
+    std::atomic<uint32_t> sequence;
+    DeferredRecordData data;
+};
+
+// The position of slots which have never been written to
+const constexpr size_t UNWRITTEN_POSITION = std::numeric_limits<size_t>::max();
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+std::unique_ptr<DeferredRecord[]> deferred_records;
+size_t deferred_mask = 0;
+std::atomic<size_t> deferred_write_pos{0};
+
+std::mutex deferred_dump_mutex{};
+size_t deferred_dump_pos = 0;
+
+/**
+ * @brief Starts storing deferred records, rather than logging them immediately.
+ *
+ * @param size The minimum amount of records to keep. If 0, does nothing.
+ */
+void start_deferred_logging(size_t size) {
+    if (size == 0) {
+        return;
+    }
+    size = std::bit_ceil(size);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    deferred_records = std::make_unique<DeferredRecord[]>(size);
+    deferred_mask = size - 1;
+    for (size_t i = 0; i < size; i++) {
+        deferred_records[i].data.position = UNWRITTEN_POSITION;
+    }
+}
+
+/**
+ * @brief Formats and logs a deferred record.
+ *
+ * @param data The record's data.
+ */
+void log_deferred_record(const DeferredRecordData& data) {
+    if (data.decoder == nullptr
+        || data.level < impl::min_level.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::array<char, impl::DEFERRED_MSG_SIZE> msg{};
+    auto size = data.decoder(data.format, data.args.data(), msg.data(), msg.size());
+
+    // Deliberately not rate limited, we want to see everything when dumping
+    const LogMessage log_msg{data.unix_time_ms, data.level, msg.data(), size, data.location,
+                             data.line};
+    output_message(log_msg);
+}
+
+#endif
+
+}  // namespace
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(void,
+               log_deferred,
+               Level level,
+               const char* format,
+               deferred_decoder decoder,
+               const uint8_t* args,
+               size_t args_size,
+               const char* location,
+               int line);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(void,
+               log_deferred,
+               Level level,
+               const char* format,
+               deferred_decoder decoder,
+               const uint8_t* args,
+               size_t args_size,
+               const char* location,
+               int line) {
+    args_size = std::min(args_size, impl::DEFERRED_ARGS_SIZE);
+
+    if (!deferred_records) {
+        DeferredRecordData data{.position = 0,
+                                .unix_time_ms = unix_ms_now(),
+                                .level = level,
+                                .format = format,
+                                .decoder = decoder,
+                                .location = location,
+                                .line = line,
+                                .args = {}};
+        memcpy(data.args.data(), args, args_size);
+        log_deferred_record(data);
+        return;
+    }
+
+    auto pos = deferred_write_pos.fetch_add(1, std::memory_order_relaxed);
+    auto& record = deferred_records[pos & deferred_mask];
+
+    // If another writer lapped us and is still writing to this slot, wait for it to finish
+    auto sequence = record.sequence.load(std::memory_order_relaxed);
+    while ((sequence & 1) != 0
+           || !record.sequence.compare_exchange_weak(sequence, sequence + 1,
+                                                     std::memory_order_acquire)) {
+        sequence = record.sequence.load(std::memory_order_relaxed);
+    }
+
+    record.data.position = pos;
+    record.data.unix_time_ms = unix_ms_now();
+    record.data.level = level;
+    record.data.format = format;
+    record.data.decoder = decoder;
+    record.data.location = location;
+    record.data.line = line;
+    memcpy(record.data.args.data(), args, args_size);
+
+    record.sequence.store(sequence + 2, std::memory_order_release);
+}
+#endif
+
+void log_deferred(Level level,
+                  const char* format,
+                  deferred_decoder decoder,
+                  const uint8_t* args,
+                  size_t args_size,
+                  const char* location,
+                  int line) {
+    UNREALSDK_MANGLE(log_deferred)(level, format, decoder, args, args_size, location, line);
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(void, dump_deferred);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(void, dump_deferred) {
+    if (!deferred_records) {
+        return;
+    }
+
+    flush_rate_limit_summaries(true, false);
+
+    const std::lock_guard<std::mutex> lock(deferred_dump_mutex);
+
+    auto end = deferred_write_pos.load(std::memory_order_acquire);
+    auto capacity = deferred_mask + 1;
+    auto start = std::max(deferred_dump_pos, end > capacity ? end - capacity : 0);
+
+    size_t skipped = start - deferred_dump_pos;
+    auto pos = start;
+    for (; pos < end; pos++) {
+        auto& record = deferred_records[pos & deferred_mask];
+
+        auto sequence = record.sequence.load(std::memory_order_acquire);
+        DeferredRecordData data{};
+        memcpy(&data, &record.data, sizeof(data));
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // If someone's writing to the slot right now, it may be the record we're after, so can't
+        // count it as overwritten yet - stop and come back to it next time
+        if ((sequence & 1) != 0 || record.sequence.load(std::memory_order_relaxed) != sequence) {
+            break;
+        }
+        // Same if the writer which claimed this position hasn't started writing yet
+        if (data.position == UNWRITTEN_POSITION || data.position < pos) {
+            break;
+        }
+        if (data.position != pos) {
+            skipped++;
+            continue;
+        }
+
+        log_deferred_record(data);
+    }
+    deferred_dump_pos = pos;
+
+    if (skipped > 0) {
+        LOG(WARNING, "Skipped {} deferred log records which were overwritten before dumping",
+            skipped);
+    }
+}
+#endif
+
+void dump_deferred(void) {
+    UNREALSDK_MANGLE(dump_deferred)();
+}
+
+#pragma endregion
+
 #ifndef UNREALSDK_IMPORTING
 void init(const std::filesystem::path& file, bool callbacks_only_arg) {
     static bool initialized = false;
@@ -204,6 +1054,18 @@ void init(const std::filesystem::path& file, bool callbacks_only_arg) {
     }
     initialized = true;
 
+    start_deferred_logging(env::get_numeric<size_t>(env::LOG_DEFERRED_SIZE));
+
+    auto env_rate_limit_level = get_level_from_string(env::get(env::LOG_RATE_LIMIT_LEVEL));
+    if (env_rate_limit_level != Level::INVALID) {
+        rate_limit_level = env_rate_limit_level;
+    }
+    rate_limit = env::get_numeric<double>(env::LOG_RATE_LIMIT, env::defaults::LOG_RATE_LIMIT);
+    rate_limit_burst =
+        env::get_numeric<double>(env::LOG_RATE_LIMIT_BURST, env::defaults::LOG_RATE_LIMIT_BURST);
+    duplicate_window = std::chrono::milliseconds{env::get_numeric<int64_t>(
+        env::LOG_DUPLICATE_WINDOW, env::defaults::LOG_DUPLICATE_WINDOW)};
+
     callbacks_only = callbacks_only_arg;
     if (callbacks_only) {
         return;
@@ -214,6 +1076,11 @@ void init(const std::filesystem::path& file, bool callbacks_only_arg) {
         unreal_console_level = env_level;
     }
 
+    auto env_min_level = get_level_from_string(env::get(env::LOG_MIN_LEVEL));
+    if (env_min_level != Level::INVALID) {
+        impl::min_level.store(env_min_level, std::memory_order_relaxed);
+    }
+
 #ifdef NDEBUG
     if (env::defined(env::EXTERNAL_CONSOLE))
 #endif
@@ -230,6 +1097,11 @@ void init(const std::filesystem::path& file, bool callbacks_only_arg) {
 
     log_file_stream = std::make_unique<std::ofstream>(file, std::ofstream::trunc);
     *log_file_stream << get_header() << std::flush;
+
+    if (env::defined(env::LOG_ASYNC)) {
+        start_async_logging(env::get_numeric<size_t>(env::LOG_ASYNC_QUEUE_SIZE,
+                                                     env::defaults::LOG_ASYNC_QUEUE_SIZE));
+    }
 }
 #endif
 
@@ -239,36 +1111,23 @@ UNREALSDK_CAPI(void, log_msg_internal, const LogMessage* msg);
 
 #ifndef UNREALSDK_IMPORTING
 UNREALSDK_CAPI(void, log_msg_internal, const LogMessage* msg) {
-    if (msg == nullptr) {
+    if (msg == nullptr || msg->level < impl::min_level.load(std::memory_order_relaxed)) {
         return;
     }
 
-    const std::lock_guard<std::mutex> lock(mutex);
+    maybe_flush_rate_limit_summaries();
 
-    for (const auto& callback : all_log_callbacks) {
-        callback(msg);
-    }
-
-    if (callbacks_only) {
+    std::string summary{};
+    if (!check_rate_limit(*msg, summary)) {
         return;
     }
 
-    if (unreal_console_level <= msg->level) {
-        unrealsdk::uconsole_output_text(utils::widen({msg->msg, msg->msg_size}));
-    }
-
-    if (external_console_handle != nullptr || log_file_stream) {
-        auto formatted = format_message(*msg);
-
-        if (external_console_handle != nullptr) {
-            WriteFile(external_console_handle, formatted.c_str(), (DWORD)formatted.size(), nullptr,
-                      nullptr);
-        }
-
-        if (log_file_stream) {
-            *log_file_stream << formatted << std::flush;
-        }
+    if (!summary.empty()) {
+        const LogMessage summary_msg{unix_ms_now(),  msg->level,    summary.data(),
+                                     summary.size(), msg->location, msg->line};
+        output_message(summary_msg);
     }
+    output_message(*msg);
 }
 #endif
 
@@ -285,6 +1144,35 @@ void log(Level level, std::wstring_view msg, const char* location, int line) {
     UNREALSDK_MANGLE(log_msg_internal)(&log_msg);
 }
 
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] const std::atomic<Level>*, get_min_level_ptr);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] const std::atomic<Level>*, get_min_level_ptr) {
+    return &impl::min_level;
+}
+#endif
+const std::atomic<Level>* get_min_level_ptr(void) {
+    return UNREALSDK_MANGLE(get_min_level_ptr)();
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(bool, set_min_level, Level level);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(bool, set_min_level, Level level) {
+    if (Level::MIN > level || level > Level::MAX) {
+        LOG(ERROR, "Log level out of range: {}", (uint8_t)level);
+        return false;
+    }
+    impl::min_level.store(level, std::memory_order_relaxed);
+    return true;
+}
+#endif
+bool set_min_level(Level level) {
+    return UNREALSDK_MANGLE(set_min_level)(level);
+}
+
 #ifdef UNREALSDK_SHARED
 UNREALSDK_CAPI(bool, set_console_level, Level level);
 #endif
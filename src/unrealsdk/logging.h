@@ -2,18 +2,29 @@
 #define UNREALSDK_LOGGING_H
 
 // Because this file in included in the pch, we can't include the pch here instead of these
+#include <atomic>
 #include <chrono>
 #include <string>
 #include "unrealsdk/format.h"
 
+// The minimum log level which is compiled in at all - any lower log calls are removed entirely.
+// Defaults to eliding misc messages in release builds. Set to one of the level names.
+#ifndef UNREALSDK_LOG_COMPILE_MIN_LEVEL
+#ifdef NDEBUG
+#define UNREALSDK_LOG_COMPILE_MIN_LEVEL DEV_WARNING
+#else
+#define UNREALSDK_LOG_COMPILE_MIN_LEVEL MISC
+#endif
+#endif
+
 namespace unrealsdk::logging {
 
 enum class Level : uint8_t {
     ERROR = 5,
     WARNING = 4,
     INFO = 3,
-    // Intended for warnings which don't concern users, so shouldn't be shown in the UE console
-    // (e.g. deprecation warnings)
+    // Intended for messages which don't concern users, so shouldn't be shown in the UE console
+    // (e.g. deprecation warnings, or the addresses found by sigscans)
     DEV_WARNING = 2,
     MISC = 1,
 
@@ -38,6 +49,55 @@ struct LogMessage {
     // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
 };
 
+const constexpr Level COMPILE_MIN_LEVEL = Level::UNREALSDK_LOG_COMPILE_MIN_LEVEL;
+
+/**
+ * @brief Gets the address of the global minimum log level.
+ * @note Should generally use `is_enabled` over this.
+ *
+ * @return A pointer to the minimum log level.
+ */
+[[nodiscard]] const std::atomic<Level>* get_min_level_ptr(void);
+
+namespace impl {
+
+#ifndef UNREALSDK_IMPORTING
+// The global minimum log level, accessed directly when it lives in this module.
+extern std::atomic<Level> min_level;
+#else
+// When it lives in another module, look up it's address once on load, so that checking it doesn't
+// need a guarded static.
+inline const std::atomic<Level>* const min_level_ptr = get_min_level_ptr();
+#endif
+
+}  // namespace impl
+
+/**
+ * @brief Checks if messages of the given level are currently being logged.
+ * @note This is checked before formatting, so is intended to be as cheap as possible.
+ *
+ * @param level The level to check.
+ * @return True if messages of this level should be logged.
+ */
+[[nodiscard]] inline bool is_enabled(Level level) {
+#ifndef UNREALSDK_IMPORTING
+    return level >= impl::min_level.load(std::memory_order_relaxed);
+#else
+    // May be called from another static initializer before we've been initialized
+    const auto* min_level = impl::min_level_ptr;
+    return min_level == nullptr || level >= min_level->load(std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * @brief Sets the minimum level of messages which get logged anywhere.
+ * @note Messages below this level are discarded before being formatted.
+ *
+ * @param level The new minimum level.
+ * @return True if the level changed, false if an invalid value was passed in.
+ */
+bool set_min_level(Level level);
+
 #ifndef UNREALSDK_IMPORTING
 /**
  * @brief Initializes logging, creating the log files and external console as needed.
@@ -58,7 +118,8 @@ void init(const std::filesystem::path& file, bool callbacks_only = false);
  * @param level The log level.
  * @param msg The message.
  * @param location The location the message was logged from. Expected to be either a path, or a
- *                 colon-namespaced function name.
+ *                 colon-namespaced function name. Only it's address is stored, so it should be a
+ *                 string literal, or otherwise stay valid and unchanged for the life of the module.
  * @param line The line number the message was logged from.
  */
 void log(Level level, std::string_view msg, const char* location, int line);
@@ -97,10 +158,17 @@ void remove_callback(log_callback callback);
  * @param level The log level name.
  * @param ... The format string + it's contents.
  */
-// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define LOG(level, ...)                                                                       \
-    unrealsdk::logging::log((unrealsdk::logging::Level::level),                               \
-                            unrealsdk::fmt::format(__VA_ARGS__), (const char*)(__FUNCTION__), \
-                            (__LINE__))
+// NOLINTBEGIN(cppcoreguidelines-macro-usage, cppcoreguidelines-avoid-do-while)
+#define LOG(level, ...)                                                                           \
+    do {                                                                                          \
+        if constexpr (unrealsdk::logging::Level::level >= unrealsdk::logging::COMPILE_MIN_LEVEL) { \
+            if (unrealsdk::logging::is_enabled(unrealsdk::logging::Level::level)) {               \
+                unrealsdk::logging::log((unrealsdk::logging::Level::level),                       \
+                                        unrealsdk::fmt::format(__VA_ARGS__),                      \
+                                        (const char*)(__FUNCTION__), (__LINE__));                 \
+            }                                                                                     \
+        }                                                                                         \
+    } while (0)
+// NOLINTEND(cppcoreguidelines-macro-usage, cppcoreguidelines-avoid-do-while)
 
 #endif /* UNREALSDK_LOGGING_H */
@@ -0,0 +1,196 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/env.h"
+#include "unrealsdk/hook_manager.h"
+#include "unrealsdk/tasks.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::tasks {
+
+namespace {
+
+#ifndef UNREALSDK_IMPORTING
+
+/*
+Each priority level gets it's own lock-free stack of incoming tasks, which any thread may push onto.
+Only the game thread ever pops from them, and it does so by swapping out the entire stack at once,
+so we don't need to worry about ABA problems.
+
+Since we take the whole stack at once, but may not have the budget to run all of it, the game
+thread moves tasks into it's own pending queues first, which nothing else touches.
+*/
+
+struct TaskNode {
+    DLLSafeCallback* callback;
+    TaskNode* next;
+};
+
+const constexpr auto PRIORITY_COUNT = static_cast<size_t>(Priority::LOW) + 1;
+
+std::array<std::atomic<TaskNode*>, PRIORITY_COUNT> incoming{};
+std::array<std::deque<DLLSafeCallback*>, PRIORITY_COUNT> pending{};
+
+std::atomic<std::thread::id> game_thread_id{};
+std::atomic<int64_t> frame_budget_us{env::defaults::TASK_FRAME_BUDGET};
+
+const std::wstring TICK_ID = L"unrealsdk_tasks_tick";
+const constexpr auto TICK_TYPE = hook_manager::Type::PRE;
+
+/**
+ * @brief Moves all incoming tasks into the pending queues.
+ */
+void take_incoming(void) {
+    for (size_t priority = 0; priority < PRIORITY_COUNT; priority++) {
+        auto node = incoming[priority].exchange(nullptr, std::memory_order_acquire);
+
+        // The stack is in reverse order, flip it back round before adding it
+        TaskNode* reversed = nullptr;
+        while (node != nullptr) {
+            auto next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        while (reversed != nullptr) {
+            pending[priority].push_back(reversed->callback);
+
+            auto next = reversed->next;
+            delete reversed;  // NOLINT(cppcoreguidelines-owning-memory)
+            reversed = next;
+        }
+    }
+}
+
+/**
+ * @brief Runs a single task.
+ *
+ * @param callback The task to run.
+ */
+void run_task(DLLSafeCallback* callback) {
+    try {
+        (*callback)();
+    } catch (const std::exception& ex) {
+        LOG(ERROR, "An exception occurred while running a task: {}", ex.what());
+    } catch (...) {
+        LOG(ERROR, "An unknown exception occurred while running a task");
+    }
+    callback->destroy();
+}
+
+bool tick_hook(hook_manager::Details& /*hook*/) {
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::microseconds{frame_budget_us.load()};
+    game_thread_id.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+    take_incoming();
+
+    // High priority tasks don't count towards this, so they can't starve the lower priorities
+    bool ran_budgeted = false;
+    for (size_t priority = 0; priority < PRIORITY_COUNT; priority++) {
+        auto budgeted = priority != static_cast<size_t>(Priority::HIGH);
+
+        auto& queue = pending[priority];
+        while (!queue.empty()) {
+            if (budgeted && ran_budgeted && std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+
+            auto callback = queue.front();
+            queue.pop_front();
+            run_task(callback);
+            if (budgeted) {
+                ran_budgeted = true;
+            }
+        }
+    }
+
+    return false;
+}
+
+#endif
+
+}  // namespace
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(void, queue_task, DLLSafeCallback* callback, Priority priority);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(void, queue_task, DLLSafeCallback* callback, Priority priority) {
+    if (static_cast<size_t>(priority) >= PRIORITY_COUNT) {
+        callback->destroy();
+        throw std::invalid_argument("Invalid task priority "
+                                    + std::to_string(static_cast<uint8_t>(priority)));
+    }
+
+    auto& head = incoming[static_cast<size_t>(priority)];
+
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto node = new TaskNode{.callback = callback, .next = head.load(std::memory_order_relaxed)};
+    while (!head.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                       std::memory_order_relaxed)) {}
+}
+#endif
+
+void queue(const Callback& callback, Priority priority) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    UNREALSDK_MANGLE(queue_task)(new DLLSafeCallback(callback), priority);
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI(void, set_task_frame_budget, int64_t budget_us);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI(void, set_task_frame_budget, int64_t budget_us) {
+    frame_budget_us = budget_us;
+}
+#endif
+
+void set_frame_budget(std::chrono::microseconds budget) {
+    UNREALSDK_MANGLE(set_task_frame_budget)(budget.count());
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] int64_t, get_task_frame_budget);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] int64_t, get_task_frame_budget) {
+    return frame_budget_us;
+}
+#endif
+
+std::chrono::microseconds get_frame_budget(void) {
+    return std::chrono::microseconds{UNREALSDK_MANGLE(get_task_frame_budget)()};
+}
+
+#ifdef UNREALSDK_SHARED
+UNREALSDK_CAPI([[nodiscard]] bool, is_game_thread);
+#endif
+#ifndef UNREALSDK_IMPORTING
+UNREALSDK_CAPI([[nodiscard]] bool, is_game_thread) {
+    return game_thread_id.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
+#endif
+
+bool is_game_thread(void) {
+    return UNREALSDK_MANGLE(is_game_thread)();
+}
+
+namespace impl {
+
+#ifndef UNREALSDK_IMPORTING
+
+void init(void) {
+    frame_budget_us = env::get_numeric<int64_t>(env::TASK_FRAME_BUDGET,
+                                                env::defaults::TASK_FRAME_BUDGET);
+
+    auto tick_func = utils::widen(env::get(env::TASK_TICK_FUNC, env::defaults::TASK_TICK_FUNC));
+    hook_manager::add_hook(tick_func, TICK_TYPE, TICK_ID, &tick_hook,
+                           hook_manager::ArgsUsage::UNUSED);
+}
+
+#endif
+
+}  // namespace impl
+
+}  // namespace unrealsdk::tasks
@@ -0,0 +1,127 @@
+#ifndef UNREALSDK_TASKS_H
+#define UNREALSDK_TASKS_H
+
+#include "unrealsdk/pch.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::tasks {
+
+/*
+You can use this module to run work on the game thread, from any thread.
+
+Queued tasks are run from a hook on a function which gets called once per frame. To avoid heavy
+workloads causing spikes, only a limited amount of time is spent running tasks each frame - once the
+budget is used up, the remaining tasks are left for the next frame. High priority tasks are exempt,
+they're always all run as soon as possible.
+
+Tasks are always run in the order they were queued within each priority level. A task queued while
+running another task will not be run until the next frame.
+*/
+
+enum class Priority : uint8_t {
+    HIGH,
+    NORMAL,
+    LOW,
+};
+
+/**
+ * @brief A task to run on the game thread.
+ */
+using DLLSafeCallback = utils::DLLSafeCallback<void>;
+using Callback = DLLSafeCallback::InnerFunc;
+
+/**
+ * @brief Queues a task to be run on the game thread.
+ * @note Safe to call from any thread.
+ *
+ * @param callback The task to run.
+ * @param priority The task's priority.
+ */
+void queue(const Callback& callback, Priority priority = Priority::NORMAL);
+
+/**
+ * @brief Queues a task to be run on the game thread, and gets a future holding it's result.
+ * @note Safe to call from any thread. Waiting on the future from the game thread will deadlock.
+ *
+ * @tparam F The type of the function to run.
+ * @param func The function to run.
+ * @param priority The task's priority.
+ * @return A future holding the function's return value, or any exception it threw.
+ */
+template <typename F>
+[[nodiscard]] std::future<std::invoke_result_t<F>> submit(F func,
+                                                          Priority priority = Priority::NORMAL) {
+    using R = std::invoke_result_t<F>;
+
+    // std::function requires copyable callables, packaged tasks aren't
+    auto task = std::make_shared<std::packaged_task<R(void)>>(std::move(func));
+    auto future = task->get_future();
+    queue([task]() { (*task)(); }, priority);
+    return future;
+}
+
+/**
+ * @brief Sets how long may be spent running tasks each frame.
+ * @note High priority tasks are always all run. Beyond those, at least one normal or low priority
+ *       task is always run each frame, even if it exceeds the budget.
+ *
+ * @param budget The new budget.
+ */
+void set_frame_budget(std::chrono::microseconds budget);
+
+/**
+ * @brief Gets how long may be spent running tasks each frame.
+ *
+ * @return The current budget.
+ */
+[[nodiscard]] std::chrono::microseconds get_frame_budget(void);
+
+/**
+ * @brief Checks if the calling thread is the game thread.
+ * @note The game thread is only known once tasks have started running, before then this always
+ *       returns false.
+ *
+ * @return True if called from the game thread.
+ */
+[[nodiscard]] bool is_game_thread(void);
+
+/**
+ * @brief Awaitable which resumes a coroutine on the game thread, as a task.
+ */
+struct ScheduleAwaiter {
+    Priority priority;
+
+    [[nodiscard]] static bool await_ready(void) noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const {
+        queue([handle]() { handle.resume(); }, this->priority);
+    }
+    static void await_resume(void) noexcept {}
+};
+
+/**
+ * @brief Gets an awaitable which resumes the awaiting coroutine on the game thread.
+ * @note Always suspends, even if already on the game thread, in which case it resumes next frame.
+ *
+ * @param priority The priority to resume at.
+ * @return The awaitable.
+ */
+[[nodiscard]] inline ScheduleAwaiter schedule(Priority priority = Priority::NORMAL) {
+    return {priority};
+}
+
+namespace impl {  // These functions are only relevant when implementing a game hook
+
+#ifndef UNREALSDK_IMPORTING
+
+/**
+ * @brief Adds the hook used to run tasks each frame.
+ */
+void init(void);
+
+#endif
+
+}  // namespace impl
+
+}  // namespace unrealsdk::tasks
+
+#endif /* UNREALSDK_TASKS_H */
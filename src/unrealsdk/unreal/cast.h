@@ -89,45 +89,34 @@ inline void default_cast_fallback(const UObject* obj) {
 #endif
 
 /**
- * @brief Implementation of cast - kept private as it has less friendly args + template args.
+ * @brief Finds the index of the class in the tuple which a class should be cast to.
  *
  * @tparam InputType The type of the input object.
- * @tparam Function The type of the callback function.
- * @tparam Fallback The type of the fallback function.
  * @tparam include_input_type True if the input type is a valid output type.
  * @tparam check_inherited_types True if to check inherited types if the first pass fails to match.
  * @tparam ClassTuple A tuple of all classes to check.
  * @tparam i The index of the tuple currently being compared against.
- * @param obj The object being cast.
  * @param working_class The class currently being matched.
- * @param func The callback function.
- * @param fallback The fallback function.
+ * @return The index of the matching class, or the size of the tuple if none matched.
  */
 template <typename InputType,
-          typename Function,
-          typename Fallback,
           bool include_input_type,
           bool check_inherited_types,
           typename ClassTuple,
-          size_t i>
-void cast_impl(const InputType* obj,
-               const UStruct* working_class,
-               const Function& func,
-               const Fallback& fallback) {
+          size_t i = 0>
+size_t find_cast_index(const UStruct* working_class) {
     // If out of elements
     if constexpr (i >= std::tuple_size_v<ClassTuple>) {
         // But we're supposed to check inherited types, and we have a super field
         if constexpr (check_inherited_types) {
             if (working_class->SuperField != nullptr) {
                 // Jump back to the start of the tuple, but use the super field
-                return cast_impl<InputType, Function, Fallback, include_input_type,
-                                 check_inherited_types, ClassTuple, 0>(
-                    obj, working_class->SuperField, func, fallback);
+                return find_cast_index<InputType, include_input_type, check_inherited_types,
+                                       ClassTuple, 0>(working_class->SuperField);
             }
         }
 
-        // Call the fallback
-        return fallback(obj);
+        return std::tuple_size_v<ClassTuple>;
 
     } else {
         // If we still have elements to check
@@ -138,15 +127,113 @@ void cast_impl(const InputType* obj,
                       && (include_input_type || !std::is_same_v<InputType, cls>)) {
             // If the class name matches
             if (working_class->Name == cls_fname<cls>()) {
-                // Run the callback
-                return func.template operator()<cls>(reinterpret_cast<const cls*>(obj));
+                return i;
             }
         }
 
         // Try the next element
-        return cast_impl<InputType, Function, Fallback, include_input_type, check_inherited_types,
-                         ClassTuple, i + 1>(obj, working_class, func, fallback);
+        return find_cast_index<InputType, include_input_type, check_inherited_types, ClassTuple,
+                               i + 1>(working_class);
+    }
+}
+
+/**
+ * @brief Finds the index of the class in the tuple which a class should be cast to, using a cache.
+ * @note The cache is a small direct mapped table per thread, so doesn't need any locking.
+ *
+ * @tparam InputType The type of the input object.
+ * @tparam include_input_type True if the input type is a valid output type.
+ * @tparam check_inherited_types True if to check inherited types if the first pass fails to match.
+ * @tparam ClassTuple A tuple of all classes to check.
+ * @param cls The class to match.
+ * @return The index of the matching class, or the size of the tuple if none matched.
+ */
+template <typename InputType,
+          bool include_input_type,
+          bool check_inherited_types,
+          typename ClassTuple>
+size_t cached_cast_index(const UStruct* cls) {
+    struct CacheEntry {
+        const UStruct* cls;
+        FName name;
+        size_t index;
+    };
+    static constexpr size_t cache_size = 64;
+    static constexpr size_t pointer_alignment_bits = 3;
+
+    thread_local std::array<CacheEntry, cache_size> cache{};
+
+    auto& entry =
+        cache[(reinterpret_cast<uintptr_t>(cls) >> pointer_alignment_bits) % cache_size];
+
+    // Since classes may be unloaded, make sure it's still got the same name, just in case another
+    // got allocated at the same address
+    if (entry.cls != cls || entry.name != cls->Name) {
+        entry = {.cls = cls,
+                 .name = cls->Name,
+                 .index = find_cast_index<InputType, include_input_type, check_inherited_types,
+                                          ClassTuple>(cls)};
+    }
+    return entry.index;
+}
+
+/**
+ * @brief Gets a function which runs the callback with the given class.
+ *
+ * @tparam InputType The type of the input object.
+ * @tparam Function The type of the callback function.
+ * @tparam include_input_type True if the input type is a valid output type.
+ * @tparam cls The class to cast to.
+ * @return A pointer to the function, or nullptr if the class is not a valid cast target.
+ */
+template <typename InputType, typename Function, bool include_input_type, typename cls>
+constexpr void (*get_cast_invoker(void))(const InputType*, const Function&) {
+    if constexpr (std::is_base_of_v<InputType, cls>
+                  && (include_input_type || !std::is_same_v<InputType, cls>)) {
+        return [](const InputType* obj, const Function& func) {
+            func.template operator()<cls>(reinterpret_cast<const cls*>(obj));
+        };
+    } else {
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Implementation of cast - kept private as it has less friendly args + template args.
+ *
+ * @tparam InputType The type of the input object.
+ * @tparam Function The type of the callback function.
+ * @tparam Fallback The type of the fallback function.
+ * @tparam include_input_type True if the input type is a valid output type.
+ * @tparam check_inherited_types True if to check inherited types if the first pass fails to match.
+ * @tparam ClassTuple A tuple of all classes to check.
+ * @tparam indexes An index sequence over the class tuple. Picked up automatically.
+ * @param obj The object being cast.
+ * @param func The callback function.
+ * @param fallback The fallback function.
+ */
+template <typename InputType,
+          typename Function,
+          typename Fallback,
+          bool include_input_type,
+          bool check_inherited_types,
+          typename ClassTuple,
+          size_t... indexes>
+void cast_impl(const InputType* obj,
+               const Function& func,
+               const Fallback& fallback,
+               std::index_sequence<indexes...> /*indexes*/) {
+    using invoker = void (*)(const InputType*, const Function&);
+    static constexpr std::array<invoker, sizeof...(indexes)> jump_table{
+        get_cast_invoker<InputType, Function, include_input_type,
+                         std::tuple_element_t<indexes, ClassTuple>>()...};
+
+    auto idx = cached_cast_index<InputType, include_input_type, check_inherited_types, ClassTuple>(
+        obj->Class);
+    if (idx >= jump_table.size()) {
+        return fallback(obj);
     }
+    return jump_table[idx](obj, func);
 }
 
 }  // namespace
@@ -227,9 +314,10 @@ void cast(const InputType* obj,
         throw std::invalid_argument("Tried to cast null object!");
     }
 
+    using class_tuple = typename Options::class_tuple_t;
     return cast_impl<InputType, Function, Fallback, Options::include_input_type_v,
-                     Options::check_inherited_types_v, typename Options::class_tuple_t, 0>(
-        obj, obj->Class, func, fallback);
+                     Options::check_inherited_types_v, class_tuple>(
+        obj, func, fallback, std::make_index_sequence<std::tuple_size_v<class_tuple>>{});
 }
 
 }  // namespace unrealsdk::unreal
@@ -34,6 +34,8 @@ template <typename T>
 struct PropTraits<CopyableProperty<T>> : public AbstractPropTraits<CopyableProperty<T>> {
     using Value = T;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const CopyableProperty<T>* /*prop*/,
                      uintptr_t addr,
                      const UnrealPointer<void>& /*parent*/) {
@@ -44,6 +46,19 @@ struct PropTraits<CopyableProperty<T>> : public AbstractPropTraits<CopyablePrope
     }
 };
 
+/**
+ * @brief Checks if a property type is a `CopyableProperty`, meaning values are stored directly as
+ *        the value type.
+ *
+ * @tparam T The property type to check.
+ */
+template <typename T>
+struct is_copyable_property : std::false_type {};
+template <typename T>
+struct is_copyable_property<CopyableProperty<T>> : std::true_type {};
+template <typename T>
+inline constexpr bool is_copyable_property_v = is_copyable_property<T>::value;
+
 using UInt8Property = CopyableProperty<int8_t>;
 using UInt16Property = CopyableProperty<int16_t>;
 using UIntProperty = CopyableProperty<int32_t>;
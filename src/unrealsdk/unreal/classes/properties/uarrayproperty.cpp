@@ -8,6 +8,7 @@
 #include "unrealsdk/unreal/wrappers/unreal_pointer.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer_funcs.h"
 #include "unrealsdk/unreal/wrappers/wrapped_array.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
 
 namespace unrealsdk::unreal {
 
@@ -41,16 +42,46 @@ void PropTraits<UArrayProperty>::set(const UArrayProperty* prop,
                                  + (std::string)inner->Name);
     }
 
-    cast(inner, [prop, addr, &value]<typename T>(const T* inner) {
+    cast(inner, [addr, &value]<typename T>(const T* inner) {
         auto arr = reinterpret_cast<TArray<void>*>(addr);
+        if (arr->data == value.base->data) {
+            return;
+        }
+
+        auto element_addr = [arr, inner](size_t idx) {
+            return reinterpret_cast<uintptr_t>(arr->data) + (inner->ElementSize * idx);
+        };
 
+        auto old_size = arr->size();
         auto new_size = value.size();
-        arr->resize(new_size, prop->ElementSize);
+
+        // Destroy any entries which will get dropped
+        if constexpr (!PropTraits<T>::TRIVIALLY_DESTRUCTIBLE) {
+            for (size_t i = new_size; i < old_size; i++) {
+                destroy_property<T>(inner, 0, element_addr(i));
+            }
+        }
+
+        arr->resize(new_size, inner->ElementSize);
+
+        // 0-initialize any new entries, so setting them doesn't try free whatever garbage was there
+        if (new_size > old_size) {
+            memset(reinterpret_cast<void*>(element_addr(old_size)), 0,
+                   (new_size - old_size) * inner->ElementSize);
+        }
+
+        // If the inner type doesn't need a deep copy, we can copy the whole array at once
+        bool trivially_copyable = PropTraits<T>::TRIVIALLY_COPYABLE;
+        if constexpr (std::is_same_v<T, UStructProperty>) {
+            trivially_copyable = is_trivially_copyable(inner->get_inner_struct());
+        }
+        if (trivially_copyable) {
+            memcpy(arr->data, value.base->data, new_size * inner->ElementSize);
+            return;
+        }
 
         for (size_t i = 0; i < new_size; i++) {
-            set_property<T>(inner, 0,
-                            reinterpret_cast<uintptr_t>(arr->data) + (inner->ElementSize * i),
-                            value.get_at<T>(i));
+            set_property<T>(inner, 0, element_addr(i), value.get_at<T>(i));
         }
     });
 }
@@ -65,9 +96,11 @@ void PropTraits<UArrayProperty>::destroy(const UArrayProperty* prop, uintptr_t a
     auto arr = reinterpret_cast<TArray<void>*>(addr);
 
     cast(inner, [arr]<typename T>(const T* inner) {
-        for (size_t i = 0; i < arr->size(); i++) {
-            destroy_property<T>(inner, 0,
-                                reinterpret_cast<uintptr_t>(arr->data) + (inner->ElementSize * i));
+        if constexpr (!PropTraits<T>::TRIVIALLY_DESTRUCTIBLE) {
+            for (size_t i = 0; i < arr->size(); i++) {
+                destroy_property<T>(
+                    inner, 0, reinterpret_cast<uintptr_t>(arr->data) + (inner->ElementSize * i));
+            }
         }
     });
 
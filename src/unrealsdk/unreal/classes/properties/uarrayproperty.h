@@ -40,6 +40,8 @@ template <>
 struct PropTraits<UArrayProperty> : public AbstractPropTraits<UArrayProperty> {
     using Value = WrappedArray;
 
+    static constexpr bool TRIVIALLY_DESTRUCTIBLE = false;
+
     static Value get(const UArrayProperty* prop, uintptr_t addr, const UnrealPointer<void>& parent);
     static void set(const UArrayProperty* prop, uintptr_t addr, const Value& value);
     static void destroy(const UArrayProperty* prop, uintptr_t addr);
@@ -41,6 +41,8 @@ template <>
 struct PropTraits<UClassProperty> : public AbstractPropTraits<UClassProperty> {
     using Value = UClass*;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const UClassProperty* prop, uintptr_t addr, const UnrealPointer<void>& parent);
     static void set(const UClassProperty* prop, uintptr_t addr, const Value& value);
 };
@@ -52,6 +52,8 @@ template <>
 struct PropTraits<UEnumProperty> : public AbstractPropTraits<UEnumProperty> {
     using Value = int64_t;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const UEnumProperty* prop, uintptr_t addr, const UnrealPointer<void>& parent);
     static void set(const UEnumProperty* prop, uintptr_t addr, const Value& value);
 };
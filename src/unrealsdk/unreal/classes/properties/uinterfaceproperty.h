@@ -42,6 +42,8 @@ template <>
 struct PropTraits<UInterfaceProperty> : public AbstractPropTraits<UInterfaceProperty> {
     using Value = UObject*;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const UInterfaceProperty* prop,
                      uintptr_t addr,
                      const UnrealPointer<void>& parent);
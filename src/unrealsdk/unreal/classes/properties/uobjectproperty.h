@@ -42,6 +42,8 @@ template <>
 struct PropTraits<UObjectProperty> : public AbstractPropTraits<UObjectProperty> {
     using Value = UObject*;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const UObjectProperty* prop,
                      uintptr_t addr,
                      const UnrealPointer<void>& parent);
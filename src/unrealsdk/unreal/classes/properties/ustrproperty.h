@@ -28,6 +28,8 @@ template <>
 struct PropTraits<UStrProperty> : public AbstractPropTraits<UStrProperty> {
     using Value = std::wstring;
 
+    static constexpr bool TRIVIALLY_DESTRUCTIBLE = false;
+
     static Value get(const UStrProperty* prop, uintptr_t addr, const UnrealPointer<void>& parent);
     static void set(const UStrProperty* prop, uintptr_t addr, const Value& value);
     static void destroy(const UStrProperty* prop, uintptr_t addr);
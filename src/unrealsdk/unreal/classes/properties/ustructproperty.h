@@ -42,6 +42,8 @@ template <>
 struct PropTraits<UStructProperty> : public AbstractPropTraits<UStructProperty> {
     using Value = WrappedStruct;
 
+    static constexpr bool TRIVIALLY_DESTRUCTIBLE = false;
+
     static Value get(const UStructProperty* prop,
                      uintptr_t addr,
                      const UnrealPointer<void>& parent);
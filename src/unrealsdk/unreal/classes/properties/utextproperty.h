@@ -28,6 +28,8 @@ template <>
 struct PropTraits<UTextProperty> : public AbstractPropTraits<UTextProperty> {
     using Value = std::wstring;
 
+    static constexpr bool TRIVIALLY_DESTRUCTIBLE = false;
+
     static Value get(const UTextProperty* prop, uintptr_t addr, const UnrealPointer<void>& parent);
     static void set(const UTextProperty* prop, uintptr_t addr, const Value& value);
     static void destroy(const UTextProperty* prop, uintptr_t addr);
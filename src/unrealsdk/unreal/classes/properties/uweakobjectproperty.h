@@ -30,6 +30,8 @@ template <>
 struct PropTraits<UWeakObjectProperty> : public AbstractPropTraits<UWeakObjectProperty> {
     using Value = UObject*;
 
+    static constexpr bool TRIVIALLY_COPYABLE = true;
+
     static Value get(const UWeakObjectProperty* prop,
                      uintptr_t addr,
                      const UnrealPointer<void>& parent);
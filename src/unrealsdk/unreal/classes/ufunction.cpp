@@ -2,16 +2,48 @@
 
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uproperty.h"
+#include "unrealsdk/unreal/struct_cache.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
 
 namespace unrealsdk::unreal {
 
-UProperty* UFunction::find_return_param(void) const {
-    for (auto prop : this->properties()) {
+namespace {
+
+StructCache<FunctionInfo> function_info_cache{[](const UStruct* type) -> FunctionInfo {
+    FunctionInfo info{.return_param = nullptr,
+                      .params = {},
+                      .out_params = {},
+                      .trivially_copyable = is_trivially_copyable(type),
+                      .trivially_destructible = is_trivially_destructible(type)};
+
+    for (auto prop : type->properties()) {
         if ((prop->PropertyFlags & UProperty::PROP_FLAG_RETURN) != 0) {
-            return prop;
+            if (info.return_param == nullptr) {
+                info.return_param = prop;
+            }
+            continue;
+        }
+        if ((prop->PropertyFlags & UProperty::PROP_FLAG_PARAM) == 0) {
+            continue;
+        }
+
+        info.params.push_back(prop);
+        if ((prop->PropertyFlags & UProperty::PROP_FLAG_OUT) != 0) {
+            info.out_params.push_back(prop);
         }
     }
-    return nullptr;
+
+    return info;
+}};
+
+}  // namespace
+
+std::shared_ptr<const FunctionInfo> function_info(const UFunction* func) {
+    return function_info_cache.get(func);
+}
+
+UProperty* UFunction::find_return_param(void) const {
+    return function_info(this)->return_param;
 }
 
 }  // namespace unrealsdk::unreal
@@ -85,6 +85,31 @@ struct ClassTraits<UFunction> {
 #pragma pack(pop)
 #endif
 
+/**
+ * @brief Information about a function's parameters.
+ */
+struct FunctionInfo {
+    /// The return param, or `nullptr` if none exists.
+    UProperty* return_param;
+    /// All params, excluding the return param, in the order they're passed.
+    std::vector<UProperty*> params;
+    /// All params which are marked as out params.
+    std::vector<UProperty*> out_params;
+    /// If all properties in the params struct may be copied with a plain memcpy.
+    bool trivially_copyable;
+    /// If no properties in the params struct need to be destroyed.
+    bool trivially_destructible;
+};
+
+/**
+ * @brief Gets information about a function's parameters.
+ * @note Cached after the first call on each function.
+ *
+ * @param func The function to get the info of.
+ * @return A shared pointer to the function's info.
+ */
+[[nodiscard]] std::shared_ptr<const FunctionInfo> function_info(const UFunction* func);
+
 }  // namespace unrealsdk::unreal
 
 #endif /* UNREALSDK_UNREAL_CLASSES_UFUNCTION_H */
@@ -41,11 +41,17 @@ size_t UProperty::class_size(void) {
         LOG(WARNING, "Couldn't find UProperty class size, defaulting to: {:#x}", size);
     } else {
         size = cls->get_struct_size();
-        LOG(MISC, "UProperty class size: {:#x}", size);
+        LOG(DEV_WARNING, "UProperty class size: {:#x}", size);
     }
     return size;
 }
 
+ptrdiff_t UProperty::init_subclass_field_shift(void) {
+    subclass_field_shift = static_cast<ptrdiff_t>(UProperty::class_size())
+                           - static_cast<ptrdiff_t>(sizeof(UProperty));
+    return subclass_field_shift;
+}
+
 #endif
 
 }  // namespace unrealsdk::unreal
@@ -104,6 +104,20 @@ class UProperty : public UField {
      */
     [[nodiscard]] static size_t class_size(void);
 
+    static constexpr auto UNKNOWN_SUBCLASS_FIELD_SHIFT = std::numeric_limits<ptrdiff_t>::min();
+
+    /// How far all subclass fields are shifted from where we've declared them. Cached so that field
+    /// reads stay inline.
+    static inline ptrdiff_t subclass_field_shift = UNKNOWN_SUBCLASS_FIELD_SHIFT;
+
+    /**
+     * @brief Initializes the subclass field shift.
+     * @note Can't be done eagerly during init, since gobjects may still be empty at that point.
+     *
+     * @return The subclass field shift.
+     */
+    [[nodiscard]] static ptrdiff_t init_subclass_field_shift(void);
+
 #endif
    public:
     /**
@@ -123,9 +137,13 @@ class UProperty : public UField {
 #ifdef UE4
         return reinterpret_cast<const PropertyType*>(this)->*field;
 #else
+        auto shift = UProperty::subclass_field_shift;
+        if (shift == UNKNOWN_SUBCLASS_FIELD_SHIFT) [[unlikely]] {
+            shift = UProperty::init_subclass_field_shift();
+        }
         return *reinterpret_cast<FieldType*>(
             reinterpret_cast<uintptr_t>(&(reinterpret_cast<const PropertyType*>(this)->*field))
-            - sizeof(UProperty) + UProperty::class_size());
+            + shift);
 #endif
     }
 
@@ -5,6 +5,7 @@
 #include "unrealsdk/unreal/classes/ufunction.h"
 #include "unrealsdk/unreal/classes/uproperty.h"
 #include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/struct_cache.h"
 #include "unrealsdk/unreal/wrappers/bound_function.h"
 #include "unrealsdk/utils.h"
 
@@ -134,21 +135,100 @@ size_t UStruct::get_struct_size(void) const {
 #endif
 }
 
-UField* UStruct::find(const FName& name) const {
-    for (auto field : this->fields()) {
-        if (field->Name == name) {
-            return field;
+#pragma region Field Index
+
+namespace {
+
+/**
+ * @brief Flat hash map from name to field.
+ * @note Only the first field added under a name is kept, which matches the order the linear
+ *       searches would find them in.
+ *
+ * @tparam T The type of field to hold.
+ */
+template <typename T>
+class FieldMap {
+   private:
+    std::vector<std::pair<FName, T*>> slots;
+
+   public:
+    /**
+     * @brief Construct a new field map.
+     *
+     * @param fields The range of fields to add.
+     */
+    template <typename R>
+    explicit FieldMap(R&& fields) {
+        auto count = (size_t)std::ranges::distance(fields);
+
+        // Keep the load factor under half, so probe chains stay short
+        size_t size = 1;
+        while (size < count * 2) {
+            size *= 2;
+        }
+        this->slots.resize(size, {FName{}, nullptr});
+
+        for (auto field : fields) {
+            auto mask = this->slots.size() - 1;
+            for (auto pos = std::hash<FName>{}(field->Name) & mask;; pos = (pos + 1) & mask) {
+                auto& [name, value] = this->slots[pos];
+                if (value == nullptr) {
+                    name = field->Name;
+                    value = field;
+                    break;
+                }
+                if (name == field->Name) {
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Finds a field by name.
+     *
+     * @param name The name of the field.
+     * @return The field, or nullptr if not found.
+     */
+    [[nodiscard]] T* find(const FName& name) const {
+        auto mask = this->slots.size() - 1;
+        for (auto pos = std::hash<FName>{}(name) & mask; this->slots[pos].second != nullptr;
+             pos = (pos + 1) & mask) {
+            if (this->slots[pos].first == name) {
+                return this->slots[pos].second;
+            }
         }
+        return nullptr;
+    }
+};
+
+struct FieldIndex {
+    FieldMap<UField> fields;
+    FieldMap<UProperty> properties;
+};
+
+StructCache<FieldIndex> field_index_cache{[](const UStruct* type) -> FieldIndex {
+    return {.fields = FieldMap<UField>{type->fields()},
+            .properties = FieldMap<UProperty>{type->properties()}};
+}};
+
+}  // namespace
+
+#pragma endregion
+
+UField* UStruct::find(const FName& name) const {
+    auto field = field_index_cache.get(this)->fields.find(name);
+    if (field != nullptr) {
+        return field;
     }
 
     throw std::invalid_argument("Couldn't find field " + (std::string)name);
 }
 
 UProperty* UStruct::find_prop(const FName& name) const {
-    for (auto prop : this->properties()) {
-        if (prop->Name == name) {
-            return prop;
-        }
+    auto prop = field_index_cache.get(this)->properties.find(name);
+    if (prop != nullptr) {
+        return prop;
     }
 
     throw std::invalid_argument("Couldn't find property " + (std::string)name);
@@ -0,0 +1,302 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/fname_index.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/structs/gnames.h"
+#include "unrealsdk/unreal/wrappers/gnames.h"
+#include "unrealsdk/unrealsdk.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::unreal {
+
+namespace {
+
+/*
+The engine's FName::Init hashes the string, takes a lock, and walks a hash chain comparing strings,
+on every single call. Since we tend to look up the same few hundred names over and over again, we
+keep our own open addressing hash table of gnames on this side, and only fall back to the engine
+when we can't find an exact match.
+
+Names are never removed from gnames, so the index only ever needs to grow - whenever we see gnames
+has gotten bigger than what we've indexed, we just add the new entries. Since that's rare, lookups
+only check the size against an atomic snapshot, and otherwise only need a shared lock.
+
+If we catch a slot the engine's still filling in, we skip it, and check it again on the next update,
+or on the next lookup which misses.
+*/
+
+struct IndexSlot {
+    static constexpr int32_t EMPTY = -1;
+
+    uint32_t hash;
+    int32_t index;
+};
+
+constexpr size_t INITIAL_INDEX_SIZE = 0x10000;
+
+std::shared_mutex index_mutex{};
+std::vector<IndexSlot> index_slots{};
+size_t used_slots = 0;
+std::atomic<size_t> indexed_names{0};
+std::vector<size_t> skipped_names{};
+std::atomic<bool> has_skipped_names{false};
+
+/**
+ * @brief Folds a character to lowercase, in the same ascii-only way the engine compares names.
+ *
+ * @param chr The character to fold.
+ * @return The folded character.
+ */
+constexpr wchar_t fold_case(wchar_t chr) {
+    return (L'A' <= chr && chr <= L'Z') ? static_cast<wchar_t>(chr - L'A' + L'a') : chr;
+}
+
+/**
+ * @brief Converts a name character to a wide character.
+ *
+ * @tparam T The character type.
+ * @param chr The character to convert.
+ * @return The wide character.
+ */
+template <typename T>
+constexpr wchar_t to_wide(T chr) {
+    if constexpr (std::is_same_v<T, char>) {
+        return static_cast<wchar_t>(static_cast<unsigned char>(chr));
+    } else {
+        return chr;
+    }
+}
+
+/**
+ * @brief Calculates the case-insensitive hash of a null terminated name.
+ *
+ * @tparam T The character type.
+ * @param str The string to hash.
+ * @return The name's hash.
+ */
+template <typename T>
+uint32_t hash_name(const T* str) {
+    // FNV-1a
+    constexpr uint32_t offset_basis = 2166136261;
+    constexpr uint32_t prime = 16777619;
+
+    uint32_t hash = offset_basis;
+    for (; *str != 0; str++) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        hash ^= static_cast<uint32_t>(fold_case(to_wide(*str)));
+        hash *= prime;
+    }
+    return hash;
+}
+
+/**
+ * @brief Checks if a name entry's string case-insensitively matches the given string.
+ *
+ * @tparam T The character type of the entry.
+ * @param entry_str The entry's null terminated string.
+ * @param str The string to compare against.
+ * @return True if the strings match.
+ */
+template <typename T>
+bool names_equal(const T* entry_str, std::wstring_view str) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (size_t i = 0; i < str.size(); i++) {
+        if (entry_str[i] == 0 || fold_case(to_wide(entry_str[i])) != fold_case(str[i])) {
+            return false;
+        }
+    }
+    return entry_str[str.size()] == 0;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * @brief Inserts a slot into the index, without checking if it needs to grow.
+ *
+ * @param slot The slot to insert.
+ */
+void insert_slot(IndexSlot slot) {
+    auto mask = index_slots.size() - 1;
+    for (auto pos = slot.hash & mask;; pos = (pos + 1) & mask) {
+        if (index_slots[pos].index == IndexSlot::EMPTY) {
+            index_slots[pos] = slot;
+            used_slots++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Ensures the index has room for at least one more entry, growing it if required.
+ */
+void ensure_capacity(void) {
+    // Keep the load factor under half, so probe chains stay short
+    if (!index_slots.empty() && (used_slots + 1) * 2 <= index_slots.size()) {
+        return;
+    }
+
+    std::vector<IndexSlot> old_slots{};
+    old_slots.swap(index_slots);
+
+    index_slots.resize(std::max(INITIAL_INDEX_SIZE, old_slots.size() * 2),
+                       {.hash = 0, .index = IndexSlot::EMPTY});
+    used_slots = 0;
+
+    for (const auto& slot : old_slots) {
+        if (slot.index != IndexSlot::EMPTY) {
+            insert_slot(slot);
+        }
+    }
+}
+
+/**
+ * @brief Adds a gnames entry to the index.
+ * @note Must be holding the index mutex exclusively.
+ *
+ * @param idx The entry's index in gnames.
+ * @param entry The entry.
+ */
+void index_entry(size_t idx, const FNameEntry* entry) {
+    ensure_capacity();
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    auto hash = entry->is_wide() ? hash_name(entry->WideName) : hash_name(entry->AnsiName);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+    insert_slot({.hash = hash, .index = static_cast<int32_t>(idx)});
+}
+
+/**
+ * @brief Adds any new gnames entries, and any previously skipped ones which are now filled in, to
+ *        the index.
+ * @note Must be holding the index mutex exclusively.
+ */
+void update_index(void) {
+    const auto& gnames = unrealsdk::gnames();
+
+    std::erase_if(skipped_names, [&gnames](size_t idx) {
+        auto entry = gnames.at(idx);
+        if (entry == nullptr) {
+            return false;
+        }
+        index_entry(idx, entry);
+        return true;
+    });
+
+    auto size = gnames.size();
+    auto idx = indexed_names.load(std::memory_order_relaxed);
+    for (; idx < size; idx++) {
+        auto entry = gnames.at(idx);
+        if (entry == nullptr) {
+            skipped_names.push_back(idx);
+            continue;
+        }
+        index_entry(idx, entry);
+    }
+
+    indexed_names.store(idx, std::memory_order_release);
+    has_skipped_names.store(!skipped_names.empty(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Looks up a string in the index.
+ * @note Must be holding the index mutex, in either mode.
+ *
+ * @param hash The string's hash.
+ * @param str The string.
+ * @return The gnames index of the matching entry, or std::nullopt if not found.
+ */
+std::optional<int32_t> find_in_index(uint32_t hash, std::wstring_view str) {
+    if (index_slots.empty()) {
+        return std::nullopt;
+    }
+
+    const auto& gnames = unrealsdk::gnames();
+    auto mask = index_slots.size() - 1;
+    for (auto pos = hash & mask; index_slots[pos].index != IndexSlot::EMPTY;
+         pos = (pos + 1) & mask) {
+        const auto& slot = index_slots[pos];
+        if (slot.hash != hash) {
+            continue;
+        }
+
+        auto entry = gnames.at(slot.index);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+        auto matches = entry->is_wide() ? names_equal(entry->WideName, str)
+                                        : names_equal(entry->AnsiName, str);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+
+        if (matches) {
+            return slot.index;
+        }
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Checks if the engine may do something other than an exact lookup when given this string.
+ *
+ * @param str The string to check.
+ * @param number The name number being used.
+ * @return True if we can handle the string in the index.
+ */
+bool is_indexable(std::wstring_view str, int32_t number) {
+    if (str.empty() || str.size() >= FNameEntry::NAME_SIZE) {
+        return false;
+    }
+
+    // We don't mirror the engine's handling of non-ascii characters
+    if (std::ranges::any_of(str, [](wchar_t chr) { return chr > 0x7F; })) {
+        return false;
+    }
+
+    // If not given a number, the engine tries to split one off of a trailing `_123`
+    if (number == 0 && L'0' <= str.back() && str.back() <= L'9') {
+        auto last_non_digit = str.find_last_not_of(L"0123456789");
+        if (last_non_digit != std::wstring_view::npos && str[last_non_digit] == L'_') {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace
+
+bool find_existing_fname(FName* name, const wchar_t* str, int32_t number) {
+    const std::wstring_view str_view{str};
+    if (!is_indexable(str_view, number)) {
+        return false;
+    }
+
+    auto hash = hash_name(str);
+
+    if (unrealsdk::gnames().size() != indexed_names.load(std::memory_order_acquire)) {
+        const std::unique_lock<std::shared_mutex> lock(index_mutex);
+        update_index();
+    }
+
+    std::optional<int32_t> idx{};
+    {
+        const std::shared_lock<std::shared_mutex> lock(index_mutex);
+        idx = find_in_index(hash, str_view);
+    }
+
+    // The name might be in one of the slots we skipped earlier, see if it's been filled in since
+    if (!idx.has_value() && has_skipped_names.load(std::memory_order_relaxed)) {
+        const std::unique_lock<std::shared_mutex> lock(index_mutex);
+        update_index();
+        idx = find_in_index(hash, str_view);
+    }
+
+    if (!idx.has_value()) {
+        return false;
+    }
+
+    *name = {*idx, number};
+    return true;
+}
+
+}  // namespace unrealsdk::unreal
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef UNREALSDK_UNREAL_FNAME_INDEX_H
+#define UNREALSDK_UNREAL_FNAME_INDEX_H
+
+#include "unrealsdk/pch.h"
+
+#ifndef UNREALSDK_IMPORTING
+
+namespace unrealsdk::unreal {
+
+struct FName;
+
+/**
+ * @brief Tries to find an existing name, using a local index of gnames, without calling the engine.
+ * @note Only exact (case-insensitive) matches on names which already exist are handled. Anything
+ *       where the engine might need to split off a number, or create a new entry, returns false,
+ *       and should be passed on to `FName::Init`.
+ *
+ * @param name Pointer to the name to write to.
+ * @param str The null terminated string to look up.
+ * @param number The name number to use.
+ * @return True if the name was found, and has been written, false otherwise.
+ */
+[[nodiscard]] bool find_existing_fname(FName* name, const wchar_t* str, int32_t number);
+
+}  // namespace unrealsdk::unreal
+
+#endif
+
+#endif /* UNREALSDK_UNREAL_FNAME_INDEX_H */
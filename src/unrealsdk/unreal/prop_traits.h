@@ -18,6 +18,13 @@ struct AbstractPropTraits {
     /// The value type used by the described property
     using Value = void*;
 
+    /// If values of the described property may be copied between instances with a plain memcpy
+    static constexpr bool TRIVIALLY_COPYABLE = false;
+
+    /// If the described property does not need to be destroyed - should be overwritten to false
+    /// whenever `destroy` is
+    static constexpr bool TRIVIALLY_DESTRUCTIBLE = true;
+
     /**
      * @brief Gets the value of the described property type from the given address.
      *
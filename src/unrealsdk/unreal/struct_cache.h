@@ -0,0 +1,114 @@
+#ifndef UNREALSDK_UNREAL_STRUCT_CACHE_H
+#define UNREALSDK_UNREAL_STRUCT_CACHE_H
+
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/structs/fname.h"
+
+namespace unrealsdk::unreal {
+
+/**
+ * @brief Side table holding lazily built data about structs, keyed by their address.
+ * @note Since structs may be unloaded, and another allocated at the same address, each entry also
+ *       remembers the struct's name, the heads of it's field lists, and it's superfield chain, and
+ *       is rebuilt if they no longer match.
+ * @note Data is handed out by shared pointer, so that rebuilding an entry doesn't free it while
+ *       another thread is still using it.
+ *
+ * @tparam T The type of data to hold per struct.
+ */
+template <typename T>
+class StructCache {
+   public:
+    using builder_func = T (*)(const UStruct* type);
+
+   private:
+    struct Entry {
+        FName name;
+        const UField* children;
+        const UProperty* property_link;
+        std::vector<const UStruct*> superfields;
+        std::shared_ptr<const T> data;
+
+        /**
+         * @brief Checks if this entry was built from the given struct.
+         *
+         * @param type The struct to check.
+         * @return True if this entry is still valid for the struct.
+         */
+        [[nodiscard]] bool matches(const UStruct* type) const {
+            if (this->children != type->Children || this->property_link != type->PropertyLink
+                || this->name != type->Name) {
+                return false;
+            }
+
+            const UStruct* super = type->SuperField;
+            for (const auto* expected : this->superfields) {
+                if (super != expected) {
+                    return false;
+                }
+                super = super->SuperField;
+            }
+            return super == nullptr;
+        }
+    };
+
+    builder_func builder;
+
+    mutable std::shared_mutex mutex;
+    std::unordered_map<const UStruct*, Entry> entries;
+
+   public:
+    /**
+     * @brief Construct a new struct cache.
+     *
+     * @param builder The function used to build the data for a struct on a cache miss.
+     */
+    StructCache(builder_func builder) : builder(builder) {}
+
+    /**
+     * @brief Gets the data for the given struct, building it if needed.
+     *
+     * @param type The struct to get the data of.
+     * @return A shared pointer to the struct's data.
+     */
+    [[nodiscard]] std::shared_ptr<const T> get(const UStruct* type) {
+        {
+            const std::shared_lock<std::shared_mutex> lock(this->mutex);
+            auto iter = this->entries.find(type);
+            if (iter != this->entries.end() && iter->second.matches(type)) {
+                return iter->second.data;
+            }
+        }
+
+        // Build outside of the lock, since the builder might want to look up other structs
+        auto data = std::make_shared<const T>(this->builder(type));
+
+        std::vector<const UStruct*> superfields{};
+        for (const UStruct* super = type->SuperField; super != nullptr;
+             super = super->SuperField) {
+            superfields.push_back(super);
+        }
+
+        const std::unique_lock<std::shared_mutex> lock(this->mutex);
+        auto& entry = this->entries[type];
+        // Another thread might have beaten us to it
+        if (entry.data != nullptr && entry.matches(type)) {
+            return entry.data;
+        }
+
+        // If this replaces a stale entry, anyone still using the old data keeps it alive until
+        // they're done with it
+        entry = {.name = type->Name,
+                 .children = type->Children,
+                 .property_link = type->PropertyLink,
+                 .superfields = std::move(superfields),
+                 .data = std::move(data)};
+        return entry.data;
+    }
+};
+
+}  // namespace unrealsdk::unreal
+
+#endif /* UNREALSDK_UNREAL_STRUCT_CACHE_H */
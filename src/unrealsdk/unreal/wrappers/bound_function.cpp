@@ -17,6 +17,12 @@ void BoundFunction::call_with_params(void* params) const {
     func->FunctionFlags = original_flags;
 }
 
+void BoundFunction::call_native_with_params(void* params) const {
+    if (!unrealsdk::call_native(this->object, this->func, params)) {
+        this->call_with_params(params);
+    }
+}
+
 UProperty* BoundFunction::get_next_param(UProperty* prop) {
     prop = prop->PropertyLinkNext;
     while (prop != nullptr && (prop->PropertyFlags & UProperty::PROP_FLAG_PARAM) == 0) {
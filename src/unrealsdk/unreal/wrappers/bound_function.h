@@ -15,7 +15,13 @@ namespace unrealsdk::unreal {
 
 struct FName;
 
+template <typename R, typename... Ts>
+class PreparedCall;
+
 class BoundFunction {
+    template <typename R, typename... Ts>
+    friend class PreparedCall;
+
    public:
     UFunction* func;
     UObject* object;
@@ -28,6 +34,14 @@ class BoundFunction {
      */
     void call_with_params(void* params) const;
 
+    /**
+     * @brief Calls this function, given a pointer to it's params struct, trying to call native
+     *        functions directly.
+     *
+     * @param params A pointer to this function's params struct.
+     */
+    void call_native_with_params(void* params) const;
+
     /**
      * @brief Get the next parameter property in the chain.
      * @note Includes optional properties.
@@ -141,7 +155,7 @@ class BoundFunction {
      */
     template <typename R, typename... Ts>
     call_return_type<R> call(const typename PropTraits<Ts>::Value&... args) {
-        WrappedStruct params{this->func};
+        WrappedStruct params{this->func, PooledAllocation{}};
         write_params<Ts...>(params, args...);
 
         this->call_with_params(params.base.get());
@@ -149,6 +163,27 @@ class BoundFunction {
             return this->get_return_value<R>(params);
         }
     }
+
+    /**
+     * @brief Calls this function, skipping `ProcessEvent` if possible.
+     * @note Falls back to a normal call if the function can't be called directly - which currently
+     *       is always the case.
+     *
+     * @tparam R The return type. If `void`, the return value is ignored (even if it exists).
+     * @tparam Ts The types of the arguments.
+     * @param args The arguments.
+     * @return The function's return value.
+     */
+    template <typename R, typename... Ts>
+    call_return_type<R> call_native(const typename PropTraits<Ts>::Value&... args) {
+        WrappedStruct params{this->func, PooledAllocation{}};
+        write_params<Ts...>(params, args...);
+
+        this->call_native_with_params(params.base.get());
+        if constexpr (!std::is_void_v<R>) {
+            return this->get_return_value<R>(params);
+        }
+    }
     template <typename R>
     call_return_type<R> call(WrappedStruct& params) {
         if (params.type != this->func) {
@@ -0,0 +1,25 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/cast.h"
+#include "unrealsdk/unreal/classes/uproperty.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/wrappers/prepared_call.h"
+
+namespace unrealsdk::unreal::impl {
+
+void reset_properties(const std::vector<UProperty*>& props, uintptr_t addr) {
+    for (auto prop : props) {
+        cast(prop, [addr]<typename T>(const T* prop) {
+            if constexpr (!PropTraits<T>::TRIVIALLY_DESTRUCTIBLE) {
+                for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
+                    destroy_property<T>(prop, i, addr);
+                }
+            }
+        });
+
+        memset(reinterpret_cast<void*>(addr + prop->Offset_Internal), 0,
+               (size_t)prop->ElementSize * prop->ArrayDim);
+    }
+}
+
+}  // namespace unrealsdk::unreal::impl
@@ -0,0 +1,306 @@
+#ifndef UNREALSDK_UNREAL_WRAPPERS_PREPARED_CALL_H
+#define UNREALSDK_UNREAL_WRAPPERS_PREPARED_CALL_H
+
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/class_name.h"
+#include "unrealsdk/unreal/classes/ufunction.h"
+#include "unrealsdk/unreal/classes/uproperty.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/wrappers/bound_function.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+
+namespace unrealsdk::unreal {
+
+class UArrayProperty;
+class UObject;
+
+namespace impl {
+
+/**
+ * @brief Destroys and 0-initializes the given properties.
+ *
+ * @param props The properties to reset.
+ * @param addr The base address of the struct holding them.
+ */
+void reset_properties(const std::vector<UProperty*>& props, uintptr_t addr);
+
+}  // namespace impl
+
+/**
+ * @brief A function call which has had it's parameter layout validated ahead of time, for calling
+ *        the same function repeatedly.
+ * @note Reuses the same params struct between calls, so is not thread safe.
+ *
+ * @tparam R The return type. If `void`, the return value is ignored (even if it exists).
+ * @tparam Ts The types of the arguments.
+ */
+template <typename R, typename... Ts>
+class PreparedCall {
+   public:
+    using return_type = std::conditional_t<std::is_void_v<R>, void, typename PropTraits<R>::Value>;
+
+    UFunction* func;
+
+   private:
+    std::array<UProperty*, sizeof...(Ts)> params;
+    UProperty* ret;
+    WrappedStruct buffer;
+    bool buffer_dirty;
+    bool trivially_destructible;
+
+    // The return param and out params, which need to be reset between batched calls
+    std::vector<UProperty*> outputs;
+    // Which of our args are also out params, and so need to be re-written between batched calls
+    std::array<bool, sizeof...(Ts)> arg_is_output;
+
+    /**
+     * @brief Gets a clean params struct to use for the next call.
+     *
+     * @return The params struct.
+     */
+    WrappedStruct& get_clean_buffer(void) {
+        if (!this->buffer_dirty) {
+            return this->buffer;
+        }
+
+        // If something's still holding onto a reference into the last call's params (e.g. a
+        // returned struct), we can't touch them, need to swap to a new buffer
+        if (this->buffer.base.use_count() > 1) {
+            this->buffer = WrappedStruct{this->func};
+        } else {
+            auto addr = reinterpret_cast<uintptr_t>(this->buffer.base.get());
+            if (!this->trivially_destructible) {
+                destroy_struct(this->func, addr);
+            }
+            memset(reinterpret_cast<void*>(addr), 0, this->func->get_struct_size());
+        }
+
+        this->buffer_dirty = false;
+        return this->buffer;
+    }
+
+    /**
+     * @brief Writes all arguments into the params struct.
+     *
+     * @tparam idxs Index sequence over the arguments.
+     * @param params The params struct to write to.
+     * @param args The arguments.
+     */
+    template <size_t... idxs>
+    void write_params(WrappedStruct& params,
+                      std::index_sequence<idxs...> /*indexes*/,
+                      const typename PropTraits<Ts>::Value&... args) {
+        if constexpr (sizeof...(Ts) > 0) {
+            auto addr = reinterpret_cast<uintptr_t>(params.base.get());
+            (PropTraits<Ts>::set(reinterpret_cast<const Ts*>(this->params[idxs]),
+                                 addr + this->params[idxs]->Offset_Internal, args),
+             ...);
+        }
+    }
+
+    /**
+     * @brief Re-writes just the arguments which are also out params into the params struct.
+     *
+     * @tparam idxs Index sequence over the arguments.
+     * @param params The params struct to write to.
+     * @param args The arguments.
+     */
+    template <size_t... idxs>
+    void write_output_params(WrappedStruct& params,
+                             std::index_sequence<idxs...> /*indexes*/,
+                             const typename PropTraits<Ts>::Value&... args) {
+        if constexpr (sizeof...(Ts) > 0) {
+            auto addr = reinterpret_cast<uintptr_t>(params.base.get());
+            ((this->arg_is_output[idxs]
+                  ? PropTraits<Ts>::set(reinterpret_cast<const Ts*>(this->params[idxs]),
+                                        addr + this->params[idxs]->Offset_Internal, args)
+                  : void()),
+             ...);
+        }
+    }
+
+    /**
+     * @brief Gets an owned copy of the return value, which doesn't reference the params struct.
+     *
+     * @param params The params struct to read from.
+     * @return The return value.
+     */
+    typename PropTraits<R>::Value copy_return_value(const WrappedStruct& params) const {
+        static_assert(!std::is_same_v<R, UArrayProperty>,
+                      "Batched calls can't return arrays, they'd reference the reused params");
+
+        // Copy construct, so that structs get a new allocation
+        const typename PropTraits<R>::Value value =
+            PropTraits<R>::get(reinterpret_cast<const R*>(this->ret),
+                               reinterpret_cast<uintptr_t>(params.base.get())
+                                   + this->ret->Offset_Internal,
+                               params.base);
+        return typename PropTraits<R>::Value{value};
+    }
+
+    using batch_return_type =
+        std::conditional_t<std::is_void_v<R>, void, std::vector<typename PropTraits<R>::Value>>;
+
+    /**
+     * @brief Runs a batch of calls.
+     *
+     * @param objs The objects to call the function on.
+     * @param write_args Function which writes the args for the call at the given index. Gets
+     *                   passed the params struct, the index, and true if it's the first call.
+     * @return The return values of each call.
+     */
+    template <typename ArgsFunc>
+    batch_return_type call_batch(std::span<UObject* const> objs, const ArgsFunc& write_args) {
+        auto& params = this->get_clean_buffer();
+        this->buffer_dirty = true;
+
+        auto addr = reinterpret_cast<uintptr_t>(params.base.get());
+
+        [[maybe_unused]] std::vector<typename PropTraits<R>::Value> results{};
+        if constexpr (!std::is_void_v<R>) {
+            results.reserve(objs.size());
+        }
+
+        for (size_t i = 0; i < objs.size(); i++) {
+            if (i != 0) {
+                impl::reset_properties(this->outputs, addr);
+            }
+            write_args(params, i, i == 0);
+
+            BoundFunction{.func = this->func, .object = objs[i]}.call_with_params(
+                params.base.get());
+
+            if constexpr (!std::is_void_v<R>) {
+                results.push_back(this->copy_return_value(params));
+            }
+        }
+
+        if constexpr (!std::is_void_v<R>) {
+            return results;
+        }
+    }
+
+   public:
+    /**
+     * @brief Prepares a new function call.
+     * @note Throws if the arguments or return type don't match the function's signature.
+     *
+     * @param func The function to call.
+     */
+    PreparedCall(UFunction* func)
+        : func(func),
+          params(),
+          ret(nullptr),
+          buffer(func),
+          buffer_dirty(false),
+          trivially_destructible(false),
+          arg_is_output() {
+        const auto info_ptr = function_info(func);
+        const auto& info = *info_ptr;
+        this->trivially_destructible = info.trivially_destructible;
+
+        this->outputs = info.out_params;
+        if (info.return_param != nullptr) {
+            this->outputs.push_back(info.return_param);
+        }
+        for (size_t i = 0; i < sizeof...(Ts) && i < info.params.size(); i++) {
+            this->arg_is_output[i] = std::ranges::find(info.out_params, info.params[i])
+                                     != info.out_params.end();
+        }
+
+        if (sizeof...(Ts) > info.params.size()) {
+            throw std::runtime_error("Too many parameters to function call!");
+        }
+        for (size_t i = 0; i < info.params.size(); i++) {
+            auto prop = info.params[i];
+            if (i < sizeof...(Ts)) {
+                if (prop->ArrayDim > 1) {
+                    throw std::runtime_error(
+                        "Function has static array argument - unsure how to handle, aborting!");
+                }
+                continue;
+            }
+#ifdef UE3
+            if ((prop->PropertyFlags & UProperty::PROP_FLAG_OPTIONAL) != 0) {
+                continue;
+            }
+#endif
+            throw std::runtime_error("Too few parameters to function call!");
+        }
+
+        [&]<size_t... idxs>(std::index_sequence<idxs...>) {
+            ((this->params[idxs] = validate_type<Ts>(info.params[idxs])), ...);
+        }(std::index_sequence_for<Ts...>{});
+
+        if constexpr (!std::is_void_v<R>) {
+            this->ret = info.return_param;
+            if (this->ret == nullptr) {
+                throw std::runtime_error("Couldn't find return param!");
+            }
+            if (this->ret->ArrayDim > 1) {
+                throw std::runtime_error(
+                    "Function has static array return param - unsure how to handle, aborting!");
+            }
+            validate_type<R>(this->ret);
+        }
+    }
+
+    /**
+     * @brief Calls the function.
+     *
+     * @param obj The object to call the function on.
+     * @param args The arguments.
+     * @return The function's return value.
+     */
+    return_type call(UObject* obj, const typename PropTraits<Ts>::Value&... args) {
+        auto& params = this->get_clean_buffer();
+        this->buffer_dirty = true;
+
+        this->write_params(params, std::index_sequence_for<Ts...>{}, args...);
+        BoundFunction{.func = this->func, .object = obj}.call_with_params(params.base.get());
+
+        if constexpr (!std::is_void_v<R>) {
+            return PropTraits<R>::get(
+                reinterpret_cast<const R*>(this->ret),
+                reinterpret_cast<uintptr_t>(params.base.get()) + this->ret->Offset_Internal,
+                params.base);
+        }
+    }
+
+    /**
+     * @brief Calls the function on many objects, reusing the same params struct.
+     * @note Only the out params and return value are reset between calls.
+     * @note Returned structs are copied, arrays may not be returned.
+     *
+     * @param objs The objects to call the function on.
+     * @param args The arguments, either shared between all calls, or one tuple per object.
+     * @return A vector of each call's return value, or void if the return type is void.
+     */
+    auto call_many(std::span<UObject* const> objs, const typename PropTraits<Ts>::Value&... args) {
+        return this->call_batch(objs, [&](WrappedStruct& params, size_t /*idx*/, bool first) {
+            if (first) {
+                this->write_params(params, std::index_sequence_for<Ts...>{}, args...);
+            } else {
+                this->write_output_params(params, std::index_sequence_for<Ts...>{}, args...);
+            }
+        });
+    }
+    auto call_many(std::span<UObject* const> objs,
+                   std::span<const std::tuple<typename PropTraits<Ts>::Value...>> args) {
+        if (objs.size() != args.size()) {
+            throw std::invalid_argument("Batched call needs one set of args per object!");
+        }
+        return this->call_batch(objs, [&](WrappedStruct& params, size_t idx, bool /*first*/) {
+            std::apply(
+                [&](const auto&... call_args) {
+                    this->write_params(params, std::index_sequence_for<Ts...>{}, call_args...);
+                },
+                args[idx]);
+        });
+    }
+};
+
+}  // namespace unrealsdk::unreal
+
+#endif /* UNREALSDK_UNREAL_WRAPPERS_PREPARED_CALL_H */
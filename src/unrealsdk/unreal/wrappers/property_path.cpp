@@ -0,0 +1,173 @@
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/class_name.h"
+#include "unrealsdk/unreal/classes/properties/uarrayproperty.h"
+#include "unrealsdk/unreal/classes/properties/uclassproperty.h"
+#include "unrealsdk/unreal/classes/properties/uobjectproperty.h"
+#include "unrealsdk/unreal/classes/properties/ustructproperty.h"
+#include "unrealsdk/unreal/classes/uclass.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uproperty.h"
+#include "unrealsdk/unreal/classes/uscriptstruct.h"
+#include "unrealsdk/unreal/classes/ustruct.h"
+#include "unrealsdk/unreal/structs/fname.h"
+#include "unrealsdk/unreal/structs/tarray.h"
+#include "unrealsdk/unreal/wrappers/property_path.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+#include "unrealsdk/utils.h"
+
+namespace unrealsdk::unreal {
+
+namespace {
+
+/**
+ * @brief Splits a single path segment into it's name and optional index.
+ *
+ * @param segment The segment to split.
+ * @param path The full path, used in error messages.
+ * @return A pair of the segment's name and index.
+ */
+std::pair<std::wstring_view, std::optional<size_t>> split_segment(std::wstring_view segment,
+                                                                  std::wstring_view path) {
+    auto bracket = segment.find(L'[');
+    if (bracket == std::wstring_view::npos) {
+        return {segment, std::nullopt};
+    }
+
+    auto name = segment.substr(0, bracket);
+    auto idx_str = segment.substr(bracket + 1);
+    if (name.empty() || idx_str.size() < 2 || idx_str.back() != L']') {
+        throw std::invalid_argument("Malformed property path: " + utils::narrow(path));
+    }
+    idx_str.remove_suffix(1);
+
+    size_t idx = 0;
+    for (auto chr : idx_str) {
+        if (chr < L'0' || L'9' < chr) {
+            throw std::invalid_argument("Malformed property path index: " + utils::narrow(path));
+        }
+        idx = (idx * 10) + (chr - L'0');  // NOLINT(readability-magic-numbers)
+    }
+
+    return {name, idx};
+}
+
+}  // namespace
+
+PropertyPath::PropertyPath(const UStruct* type, std::wstring_view path)
+    : type(type), final_offset(0), prop(nullptr), derefs_object(false) {
+    if (path.empty()) {
+        throw std::invalid_argument("Property path may not be empty");
+    }
+
+    const UStruct* current_struct = type;
+    size_t offset = 0;
+
+    for (auto remaining = path;;) {
+        auto dot = remaining.find(L'.');
+        auto [name, idx] = split_segment(remaining.substr(0, dot), path);
+        if (name.empty()) {
+            throw std::invalid_argument("Malformed property path: " + utils::narrow(path));
+        }
+
+        auto segment_prop = current_struct->find_prop(FName{name});
+
+        if (idx.has_value() && segment_prop->Class->Name == cls_fname<UArrayProperty>()) {
+            auto inner = reinterpret_cast<UArrayProperty*>(segment_prop)->get_inner();
+            this->steps.push_back({.offset = offset + segment_prop->Offset_Internal,
+                                   .kind = Step::Kind::INDEX_ARRAY,
+                                   .index = *idx,
+                                   .element_size = (size_t)inner->ElementSize});
+            offset = 0;
+            segment_prop = inner;
+        } else {
+            if (idx.value_or(0) >= (size_t)segment_prop->ArrayDim) {
+                throw std::out_of_range("Property index out of range: " + utils::narrow(path));
+            }
+            offset += segment_prop->Offset_Internal + (idx.value_or(0) * segment_prop->ElementSize);
+        }
+
+        if (dot == std::wstring_view::npos) {
+            this->final_offset = offset;
+            this->prop = segment_prop;
+            break;
+        }
+        remaining = remaining.substr(dot + 1);
+
+        // Step through into the next struct
+        auto cls_name = segment_prop->Class->Name;
+        if (cls_name == cls_fname<UStructProperty>()) {
+            current_struct = reinterpret_cast<UStructProperty*>(segment_prop)->get_inner_struct();
+        } else if (cls_name == cls_fname<UObjectProperty>()
+                   || cls_name == cls_fname<UClassProperty>()) {
+            this->steps.push_back({.offset = offset,
+                                   .kind = Step::Kind::DEREF_OBJECT,
+                                   .index = 0,
+                                   .element_size = 0});
+            offset = 0;
+            this->derefs_object = true;
+            current_struct = reinterpret_cast<UObjectProperty*>(segment_prop)->get_property_class();
+        } else {
+            throw std::invalid_argument("Can't step through property "
+                                        + (std::string)segment_prop->Name
+                                        + " of type " + (std::string)cls_name);
+        }
+    }
+}
+
+UProperty* PropertyPath::get_property(void) const {
+    return this->prop;
+}
+
+uintptr_t PropertyPath::validate_base(const UObject* obj) const {
+    if (obj == nullptr) {
+        throw std::invalid_argument("Tried to resolve property path on null object!");
+    }
+    if (obj->Class != this->type && !obj->Class->inherits(this->type)) {
+        throw std::invalid_argument("Object is not an instance of "
+                                    + (std::string)this->type->Name);
+    }
+    return reinterpret_cast<uintptr_t>(obj);
+}
+
+uintptr_t PropertyPath::validate_base(const WrappedStruct& obj) const {
+    if (obj.base == nullptr) {
+        throw std::invalid_argument("Tried to resolve property path on null struct!");
+    }
+    if (obj.type != this->type && !obj.type->inherits(this->type)) {
+        throw std::invalid_argument("Struct is not an instance of "
+                                    + (std::string)this->type->Name);
+    }
+    return reinterpret_cast<uintptr_t>(obj.base.get());
+}
+
+uintptr_t PropertyPath::resolve(uintptr_t base) const {
+    auto addr = base;
+    for (const auto& step : this->steps) {
+        addr += step.offset;
+
+        switch (step.kind) {
+            case Step::Kind::DEREF_OBJECT: {
+                auto obj = *reinterpret_cast<UObject**>(addr);
+                if (obj == nullptr) {
+                    throw std::runtime_error(
+                        "Encountered null object while resolving property path");
+                }
+                addr = reinterpret_cast<uintptr_t>(obj);
+                break;
+            }
+            case Step::Kind::INDEX_ARRAY: {
+                auto arr = reinterpret_cast<TArray<void>*>(addr);
+                if (step.index >= arr->size()) {
+                    throw std::out_of_range(
+                        "Array index out of range while resolving property path");
+                }
+                addr = reinterpret_cast<uintptr_t>(arr->data) + (step.index * step.element_size);
+                break;
+            }
+        }
+    }
+    return addr + this->final_offset;
+}
+
+}  // namespace unrealsdk::unreal
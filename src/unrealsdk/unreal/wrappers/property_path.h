@@ -0,0 +1,123 @@
+#ifndef UNREALSDK_UNREAL_WRAPPERS_PROPERTY_PATH_H
+#define UNREALSDK_UNREAL_WRAPPERS_PROPERTY_PATH_H
+
+#include "unrealsdk/pch.h"
+
+#include "unrealsdk/unreal/class_name.h"
+#include "unrealsdk/unreal/classes/uobject.h"
+#include "unrealsdk/unreal/classes/uproperty.h"
+#include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/wrappers/unreal_pointer.h"
+#include "unrealsdk/unreal/wrappers/wrapped_struct.h"
+
+namespace unrealsdk::unreal {
+
+class UStruct;
+
+/**
+ * @brief A dotted/indexed path of properties, such as `A.B[3].C`, which has been resolved ahead of
+ *        time into a list of offsets.
+ * @note Object and struct properties may be stepped through. Indexes on dynamic arrays index into
+ *       the array, while indexes on any other property index it's fixed array.
+ */
+class PropertyPath {
+   private:
+    struct Step {
+        enum class Kind : uint8_t {
+            DEREF_OBJECT,
+            INDEX_ARRAY,
+        };
+
+        size_t offset;
+        Kind kind;
+        size_t index;
+        size_t element_size;
+    };
+
+    const UStruct* type;
+    std::vector<Step> steps;
+    size_t final_offset;
+    UProperty* prop;
+    bool derefs_object;
+
+    /**
+     * @brief Resolves the path against the given base address.
+     * @note Throws if a null object is encountered, or an array index is out of range.
+     *
+     * @param base The base address of the starting struct.
+     * @return The address of the final property's value.
+     */
+    [[nodiscard]] uintptr_t resolve(uintptr_t base) const;
+
+    /**
+     * @brief Validates an object is an instance of the path's starting struct.
+     *
+     * @param obj The object to validate.
+     * @return The object's base address.
+     */
+    [[nodiscard]] uintptr_t validate_base(const UObject* obj) const;
+    [[nodiscard]] uintptr_t validate_base(const WrappedStruct& obj) const;
+
+   public:
+    /**
+     * @brief Parses and resolves a new property path.
+     * @note Throws if any segment of the path can't be found, or can't be stepped through.
+     *
+     * @param type The struct the path starts from.
+     * @param path The path.
+     */
+    PropertyPath(const UStruct* type, std::wstring_view path);
+
+    /**
+     * @brief Gets the property at the end of the path.
+     *
+     * @return The final property.
+     */
+    [[nodiscard]] UProperty* get_property(void) const;
+
+    /**
+     * @brief Gets the value at the end of the path.
+     *
+     * @tparam T The type of the final property.
+     * @param obj The object or struct to start from.
+     * @return The property's value.
+     */
+    template <typename T>
+    [[nodiscard]] typename PropTraits<T>::Value get(const UObject* obj) const {
+        auto prop = validate_type<T>(this->prop);
+        return PropTraits<T>::get(prop, this->resolve(this->validate_base(obj)), {nullptr});
+    }
+    template <typename T>
+    [[nodiscard]] typename PropTraits<T>::Value get(const WrappedStruct& obj) const {
+        auto prop = validate_type<T>(this->prop);
+        auto addr = this->resolve(this->validate_base(obj));
+
+        // If we haven't left the struct's allocation, make sure the value keeps it alive
+        if (this->derefs_object) {
+            return PropTraits<T>::get(prop, addr, {nullptr});
+        }
+        return PropTraits<T>::get(prop, addr, obj.base);
+    }
+
+    /**
+     * @brief Sets the value at the end of the path.
+     *
+     * @tparam T The type of the final property.
+     * @param obj The object or struct to start from.
+     * @param value The property's new value.
+     */
+    template <typename T>
+    void set(UObject* obj, const typename PropTraits<T>::Value& value) const {
+        auto prop = validate_type<T>(this->prop);
+        PropTraits<T>::set(prop, this->resolve(this->validate_base(obj)), value);
+    }
+    template <typename T>
+    void set(WrappedStruct& obj, const typename PropTraits<T>::Value& value) const {
+        auto prop = validate_type<T>(this->prop);
+        PropTraits<T>::set(prop, this->resolve(this->validate_base(obj)), value);
+    }
+};
+
+}  // namespace unrealsdk::unreal
+
+#endif /* UNREALSDK_UNREAL_WRAPPERS_PROPERTY_PATH_H */
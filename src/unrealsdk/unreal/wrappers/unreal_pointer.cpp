@@ -1,20 +1,89 @@
+#include "unrealsdk/pch.h"
+
 #include "unrealsdk/unreal/wrappers/unreal_pointer.h"
+#include "unrealsdk/unrealsdk.h"
 
 namespace unrealsdk::unreal::impl {
 
-size_t UnrealPointerControl::inc_ref(void) {
-    if (this->refs == std::numeric_limits<size_t>::max()) {
-        throw std::runtime_error("Unreal smart pointer reached maximum references!");
+namespace {
+
+/*
+Every hooked call, and every function call we make, allocates a params struct, which would otherwise
+mean an engine malloc and free each time. Since these are so short lived, we keep a few recently
+freed blocks around to reuse.
+
+Blocks are bucketed by size rather than by struct type, so we never have to worry about a struct
+being unloaded while it still has pooled blocks. The pool is thread local, so it doesn't need any
+locking - blocks may still be freed on a different thread than they were allocated on, since
+they're all just engine allocations in the end.
+
+The pool is deliberately never freed on thread exit, since the main thread may not exit until after
+the engine allocator's been torn down. It's small enough that leaking it is preferable.
+*/
+
+constexpr size_t POOL_GRANULARITY = 0x10;
+constexpr size_t POOL_BUCKET_COUNT = 0x40;
+constexpr size_t POOL_MAX_BLOCKS_PER_BUCKET = 8;
+
+struct PoolBucket {
+    std::array<void*, POOL_MAX_BLOCKS_PER_BUCKET> blocks;
+    size_t count;
+};
+
+thread_local std::array<PoolBucket, POOL_BUCKET_COUNT> pool{};
+
+/**
+ * @brief Gets the pool bucket holding blocks of the given size.
+ *
+ * @param pool_block_size The block size.
+ * @return The bucket.
+ */
+PoolBucket& get_bucket(size_t pool_block_size) {
+    return pool[(pool_block_size / POOL_GRANULARITY) - 1];
+}
+
+}  // namespace
+
+size_t get_pool_block_size(size_t size) {
+    auto block_size = (size + POOL_GRANULARITY - 1) & ~(POOL_GRANULARITY - 1);
+    return block_size <= POOL_GRANULARITY * POOL_BUCKET_COUNT ? block_size : 0;
+}
+
+void* alloc_block(size_t size, size_t pool_block_size) {
+    if (pool_block_size == 0) {
+        return unrealsdk::u_malloc(size);
+    }
+
+    auto& bucket = get_bucket(pool_block_size);
+    if (bucket.count == 0) {
+        return unrealsdk::u_malloc(pool_block_size);
     }
-    return ++this->refs;
+
+    auto block = bucket.blocks[--bucket.count];
+    memset(block, 0, pool_block_size);
+    return block;
 }
 
-size_t UnrealPointerControl::dec_ref(void) {
-    if (this->refs == 0) {
-        throw std::runtime_error(
-            "Tried to decrement reference from unreal smart pointer already at zero!");
+void free_block(void* block, size_t pool_block_size) {
+    if (pool_block_size != 0) {
+        auto& bucket = get_bucket(pool_block_size);
+        if (bucket.count < POOL_MAX_BLOCKS_PER_BUCKET) {
+            bucket.blocks[bucket.count++] = block;
+            return;
+        }
     }
-    return --this->refs;
+
+    unrealsdk::u_free(block);
+}
+
+const uint8_t THIS_MODULE_MARKER = 0;
+
+size_t UnrealPointerControl::inc_ref(void) {
+    return this->local_inc_ref();
+}
+
+size_t UnrealPointerControl::dec_ref(void) {
+    return this->local_dec_ref();
 }
 
 }  // namespace unrealsdk::unreal::impl
@@ -7,8 +7,47 @@ namespace unrealsdk::unreal {
 
 class UStruct;
 
+/**
+ * @brief Tag type used to request a pointer's memory is taken from a small thread local pool of
+ *        recently freed blocks, rather than always going through the engine allocator.
+ * @note Intended for short lived allocations, such as function params.
+ */
+struct PooledAllocation {};
+
 namespace impl {
 
+/**
+ * @brief Gets the size of the pooled block used to hold an allocation of the given size.
+ *
+ * @param size The size of the allocation.
+ * @return The size of the pooled block, or 0 if too large to be pooled.
+ */
+[[nodiscard]] size_t get_pool_block_size(size_t size);
+
+/**
+ * @brief Allocates a block of memory, taking it from the pool if possible.
+ * @note Always returns 0-initialized memory.
+ *
+ * @param size The size of the allocation.
+ * @param pool_block_size The size of the pooled block to use, or 0 if not to pool the allocation.
+ * @return A pointer to the allocated memory.
+ */
+[[nodiscard]] void* alloc_block(size_t size, size_t pool_block_size);
+
+/**
+ * @brief Frees a block of memory, returning it to the pool if possible.
+ *
+ * @param block The block to free.
+ * @param pool_block_size The pooled block size it was allocated with, or 0 if not pooled.
+ */
+void free_block(void* block, size_t pool_block_size);
+
+/**
+ * @brief A marker unique to each module, whose address is used to identify which module created a
+ *        control block.
+ */
+extern const uint8_t THIS_MODULE_MARKER;
+
 class UnrealPointerControl {
    private:
     // As an implementation detail, we don't need to store the base address of the allocation
@@ -19,9 +58,10 @@ class UnrealPointerControl {
     // However in practice, we expect it to be implemented entirely in hardware
     // To make sure it's safe, we:
     // - Make sure it's always lock free - i.e. it's implemented in hardware.
-    // - Make all accesses go through virtual functions, so we always use the implementation of
-    //   the library which created the atomic. This kind of does the same as the last point, but
-    //   it's an extra level of safety.
+    // - Make all accesses to control blocks created by another module go through virtual
+    //   functions, so we always use the implementation of the library which created the atomic.
+    //   This kind of does the same as the last point, but it's an extra level of safety. Blocks
+    //   created by our own module can safely skip the virtual call.
     // - Make sure it has the same size and alignment as the base type, to make sure it won't
     //   change the overall layout of the control block.
     static_assert(std::atomic<size_t>::is_always_lock_free
@@ -29,6 +69,34 @@ class UnrealPointerControl {
                       && alignof(std::atomic<size_t>) == alignof(size_t),
                   "atomic size_t may not be safe to cross dll boundaries");
 
+    // The module which created this control block.
+    const void* owner;
+
+    /**
+     * @brief Increments the reference count, using this module's implementation.
+     *
+     * @return The new reference count.
+     */
+    size_t local_inc_ref(void) {
+        if (this->refs == std::numeric_limits<size_t>::max()) {
+            throw std::runtime_error("Unreal smart pointer reached maximum references!");
+        }
+        return ++this->refs;
+    }
+
+    /**
+     * @brief Decrements the reference count, using this module's implementation.
+     *
+     * @return The new reference count.
+     */
+    size_t local_dec_ref(void) {
+        if (this->refs == 0) {
+            throw std::runtime_error(
+                "Tried to decrement reference from unreal smart pointer already at zero!");
+        }
+        return --this->refs;
+    }
+
    public:
     // The only way get a pointer owned by the sdk (excluding calling u_malloc) is by making a new
     // struct - we have a specific constructor on the just for it.
@@ -38,10 +106,17 @@ class UnrealPointerControl {
     // comprehensive custom deleter.
     const UStruct* deleter_struct;
 
+    // The size of the pooled block this allocation was taken from, or 0 if it was not pooled.
+    size_t pool_block_size;
+
     /**
      * @brief Construct a new control block.
      */
-    UnrealPointerControl(const UStruct* deleter_struct) : refs(0), deleter_struct(deleter_struct) {}
+    UnrealPointerControl(const UStruct* deleter_struct, size_t pool_block_size = 0)
+        : refs(0),
+          owner(&THIS_MODULE_MARKER),
+          deleter_struct(deleter_struct),
+          pool_block_size(pool_block_size) {}
 
     /**
      * @brief Destroys the control block.
@@ -63,6 +138,40 @@ class UnrealPointerControl {
      */
     virtual size_t dec_ref(void);
 
+    /**
+     * @brief Gets the current reference count.
+     * @note Only a snapshot, may be out of date by the time it's used if shared between threads.
+     *
+     * @return The reference count.
+     */
+    [[nodiscard]] size_t get_refs(void) const { return this->refs.load(); }
+
+    /**
+     * @brief Increments the reference count, inline if the control block was created by this
+     *        module, or through the virtual function otherwise.
+     *
+     * @return The new reference count.
+     */
+    size_t inc_ref_fast(void) {
+        if (this->owner == &THIS_MODULE_MARKER) [[likely]] {
+            return this->local_inc_ref();
+        }
+        return this->inc_ref();
+    }
+
+    /**
+     * @brief Decrements the reference count, inline if the control block was created by this
+     *        module, or through the virtual function otherwise.
+     *
+     * @return The new reference count.
+     */
+    size_t dec_ref_fast(void) {
+        if (this->owner == &THIS_MODULE_MARKER) [[likely]] {
+            return this->local_dec_ref();
+        }
+        return this->dec_ref();
+    }
+
     UnrealPointerControl(const UnrealPointerControl& other) = delete;
     UnrealPointerControl(UnrealPointerControl&& other) noexcept = delete;
     UnrealPointerControl& operator=(const UnrealPointerControl& other) = delete;
@@ -93,6 +202,14 @@ class UnrealPointer {
      */
     void release(void);
 
+    /**
+     * @brief Allocates a new block of memory holding a specific struct, and takes a reference.
+     *
+     * @param struct_type The type of struct to construct.
+     * @param pooled True if to take the memory from the pool.
+     */
+    void allocate(const UStruct* struct_type, bool pooled);
+
     /**
      * @brief Tries to increment the reference count in the control block, and turns this pointer
      *        into a null pointer if an exception is thrown.
@@ -103,7 +220,7 @@ class UnrealPointer {
         // better to do nothing
         try {
             if (this->control != nullptr) {
-                this->control->inc_ref();
+                this->control->inc_ref_fast();
             }
         } catch (...) {
             this->control = nullptr;
@@ -120,10 +237,12 @@ class UnrealPointer {
 
     /**
      * @brief Constructs a pointer to a new block of memory holding a specific struct.
+     * @note If given the pooled tag, the memory is taken from, and returned to, the pool.
      *
      * @param struct_type The type of struct to construct.
      */
     UnrealPointer(const UStruct* struct_type);
+    UnrealPointer(const UStruct* struct_type, PooledAllocation /*pooled*/);
 
     /**
      * @brief Construct a new pointer pointing at memory owned by another pointer.
@@ -184,6 +303,15 @@ class UnrealPointer {
     operator T*() const { return this->ptr; }
     [[nodiscard]] T* get(void) const noexcept { return this->ptr; }
 
+    /**
+     * @brief Gets how many pointers currently share ownership of this pointer's memory.
+     *
+     * @return The number of owners, or 0 if the memory isn't owned by the sdk.
+     */
+    [[nodiscard]] size_t use_count(void) const {
+        return this->control == nullptr ? 0 : this->control->get_refs();
+    }
+
     /**
      * @brief Deferences this pointer.
      *
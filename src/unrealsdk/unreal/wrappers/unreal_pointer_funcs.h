@@ -17,7 +17,10 @@ void UnrealPointer<T>::release(void) {
     // If dec_ref throws, we can't be sure there aren't other references to the control block,
     // so we can't really do anything, better to potentially leak than free something used
     // elsewhere
-    if (old_control != nullptr && old_control->dec_ref() == 0) {
+    if (old_control != nullptr && old_control->dec_ref_fast() == 0) {
+        // Grab this before we run the destructor
+        auto pool_block_size = old_control->pool_block_size;
+
         // If the destructors throw, we still want to free the memory
         try {
             // Destroy the struct first, since we know it's less catastrophic to miss the control
@@ -33,36 +36,49 @@ void UnrealPointer<T>::release(void) {
             // Since we're using placement new, we need to manually call the destructor
             old_control->~UnrealPointerControl();
         } catch (const std::exception& ex) {
-            unrealsdk::u_free(old_control);
+            impl::free_block(old_control, pool_block_size);
             LOG(ERROR, "Exception in unreal pointer destructor: {}", ex.what());
             throw;
         } catch (...) {
-            unrealsdk::u_free(old_control);
+            impl::free_block(old_control, pool_block_size);
             LOG(ERROR, "Unknown exception in unreal pointer destructor");
             throw;
         }
-        unrealsdk::u_free(old_control);
+        impl::free_block(old_control, pool_block_size);
     }
 }
 
 template <typename T>
 UnrealPointer<T>::UnrealPointer(const UStruct* struct_type) : control(nullptr), ptr(nullptr) {
+    this->allocate(struct_type, false);
+}
+
+template <typename T>
+UnrealPointer<T>::UnrealPointer(const UStruct* struct_type, PooledAllocation /*pooled*/)
+    : control(nullptr), ptr(nullptr) {
+    this->allocate(struct_type, true);
+}
+
+template <typename T>
+void UnrealPointer<T>::allocate(const UStruct* struct_type, bool pooled) {
+    auto size = struct_type->get_struct_size() + sizeof(impl::UnrealPointerControl);
+    auto pool_block_size = pooled ? impl::get_pool_block_size(size) : 0;
+
     // If malloc throws, it should have handled freeing memory if required
-    auto buf =
-        unrealsdk::u_malloc(struct_type->get_struct_size() + sizeof(impl::UnrealPointerControl));
+    auto buf = impl::alloc_block(size, pool_block_size);
 
     // Otherwise, if we throw during initialization we need to free manually
     try {
         // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-        this->control = new (buf) impl::UnrealPointerControl(struct_type);
+        this->control = new (buf) impl::UnrealPointerControl(struct_type, pool_block_size);
 
         this->ptr = reinterpret_cast<T*>(this->control + 1);
     } catch (const std::exception& ex) {
-        unrealsdk::u_free(buf);
+        impl::free_block(buf, pool_block_size);
         LOG(ERROR, "Exception in unreal pointer constructor: {}", ex.what());
         throw;
     } catch (...) {
-        unrealsdk::u_free(buf);
+        impl::free_block(buf, pool_block_size);
         LOG(ERROR, "Unknown exception in unreal pointer constructor");
         throw;
     }
@@ -2,6 +2,7 @@
 
 #include "unrealsdk/unreal/cast.h"
 #include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/structs/tarray_funcs.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer_funcs.h"
 #include "unrealsdk/unreal/wrappers/wrapped_array.h"
@@ -35,22 +36,71 @@ void WrappedArray::reserve(size_t new_cap) const {
 
 void WrappedArray::resize(size_t new_size) {
     size_t old_size = this->base->size();
-    cast(this->type, [&]<typename T>(const T* /*inner*/) {
-        // Destroy any entries which will get dropped
-        for (size_t idx = new_size; idx < old_size; idx++) {
-            this->destroy_at<T>(idx);
-        }
-    });
+
+    // Destroy any entries which will get dropped
+    if (new_size < old_size) {
+        this->destroy_range(new_size, old_size);
+    }
 
     this->base->resize(new_size, this->type->ElementSize);
 
     // 0-initialize any new entries
     if (new_size > old_size) {
-        auto data_ptr = reinterpret_cast<uintptr_t>(this->base->data);
-        auto start = data_ptr + (old_size * this->type->ElementSize);
+        auto start = this->element_addr(old_size);
         auto length = (new_size - old_size) * this->type->ElementSize;
         memset(reinterpret_cast<void*>(start), 0, length);
     }
 }
 
+void WrappedArray::erase_range(size_t start, size_t end) {
+    auto size = this->size();
+    if (start > end || end > size) {
+        throw std::out_of_range("WrappedArray erase range out of range");
+    }
+    if (start == end) {
+        return;
+    }
+
+    this->destroy_range(start, end);
+
+    memmove(reinterpret_cast<void*>(this->element_addr(start)),
+            reinterpret_cast<void*>(this->element_addr(end)),
+            (size - end) * this->type->ElementSize);
+
+    this->base->count = (decltype(this->base->count))(size - (end - start));
+}
+
+void WrappedArray::insert_gap(size_t idx, size_t count) {
+    auto old_size = this->size();
+    auto element_size = (size_t)this->type->ElementSize;
+
+    // Resize handles growing with slack, only reallocating once
+    this->base->resize(old_size + count, element_size);
+
+    memmove(reinterpret_cast<void*>(this->element_addr(idx + count)),
+            reinterpret_cast<void*>(this->element_addr(idx)), (old_size - idx) * element_size);
+    memset(reinterpret_cast<void*>(this->element_addr(idx)), 0, count * element_size);
+}
+
+void WrappedArray::apply_order(const std::vector<size_t>& order) {
+    auto element_size = (size_t)this->type->ElementSize;
+
+    std::vector<uint8_t> buffer(order.size() * element_size);
+    for (size_t idx = 0; idx < order.size(); idx++) {
+        memcpy(&buffer[idx * element_size],
+               reinterpret_cast<void*>(this->element_addr(order[idx])), element_size);
+    }
+    memcpy(reinterpret_cast<void*>(this->base->data), buffer.data(), buffer.size());
+}
+
+void WrappedArray::destroy_range(size_t start, size_t end) {
+    cast(this->type, [&]<typename T>(const T* inner) {
+        if constexpr (!PropTraits<T>::TRIVIALLY_DESTRUCTIBLE) {
+            for (size_t idx = start; idx < end; idx++) {
+                PropTraits<T>::destroy(inner, this->element_addr(idx));
+            }
+        }
+    });
+}
+
 }  // namespace unrealsdk::unreal
@@ -4,6 +4,7 @@
 #include "unrealsdk/pch.h"
 
 #include "unrealsdk/unreal/class_name.h"
+#include "unrealsdk/unreal/classes/properties/copyable_property.h"
 #include "unrealsdk/unreal/classes/uclass.h"
 #include "unrealsdk/unreal/classes/uproperty.h"
 #include "unrealsdk/unreal/prop_traits.h"
@@ -61,26 +62,80 @@ class WrappedArray {
      */
     void resize(size_t new_size);
 
+    /**
+     * @brief Erases a range of elements from the array, shifting all later elements down.
+     * @note Only the erased elements are destroyed.
+     *
+     * @param start The index of the first element to erase.
+     * @param end The index one past the last element to erase.
+     */
+    void erase_range(size_t start, size_t end);
+
    private:
     /**
-     * @brief Type and bound check an access to this array.
+     * @brief Opens up a gap of 0-initialized elements in the array, shifting all later elements up.
+     * @note Grows the capacity at most once.
+     *
+     * @param idx The index to open the gap at.
+     * @param count The number of elements in the gap.
+     */
+    void insert_gap(size_t idx, size_t count);
+
+    /**
+     * @brief Rearranges the array's elements as raw memory.
+     *
+     * @param order The new order, where `order[i]` is the current index of the element which should
+     *              end up at index i.
+     */
+    void apply_order(const std::vector<size_t>& order);
+
+    /**
+     * @brief Destroys a range of elements in the array, without removing them.
+     *
+     * @param start The index of the first element to destroy.
+     * @param end The index one past the last element to destroy.
+     */
+    void destroy_range(size_t start, size_t end);
+
+    /**
+     * @brief Type checks an access to this array.
      *
      * @tparam T The expected property type
-     * @param idx The index being accessed.
      */
     template <typename T>
-    void validate_access(size_t idx) const {
+    void validate_type(void) const {
         auto property_class = this->type->Class->Name;
         if (property_class != cls_fname<T>()) {
             throw std::invalid_argument("WrappedArray property was of invalid type "
                                         + (std::string)property_class);
         }
+    }
+
+    /**
+     * @brief Type and bound check an access to this array.
+     *
+     * @tparam T The expected property type
+     * @param idx The index being accessed.
+     */
+    template <typename T>
+    void validate_access(size_t idx) const {
+        this->validate_type<T>();
 
         if (idx > (size_t)this->base->count) {
             throw std::out_of_range("WrappedArray index out of range");
         }
     }
 
+    /**
+     * @brief Gets the address of an element in the array, without any checks.
+     *
+     * @param idx The index to get.
+     * @return The element's address.
+     */
+    [[nodiscard]] uintptr_t element_addr(size_t idx) const {
+        return reinterpret_cast<uintptr_t>(this->base->data) + (this->type->ElementSize * idx);
+    }
+
    public:
     /**
      * @brief Gets an element in the array, with bounds and type checking.
@@ -92,10 +147,8 @@ class WrappedArray {
     template <typename T>
     [[nodiscard]] typename PropTraits<T>::Value get_at(size_t idx) const {
         this->validate_access<T>(idx);
-        return get_property<T>(
-            reinterpret_cast<const T*>(this->type), 0,
-            reinterpret_cast<uintptr_t>(this->base->data) + (this->type->ElementSize * idx),
-            this->base);
+        return get_property<T>(reinterpret_cast<const T*>(this->type), 0,
+                               this->element_addr(idx), this->base);
     }
 
     /**
@@ -108,9 +161,221 @@ class WrappedArray {
     template <typename T>
     void set_at(size_t idx, const typename PropTraits<T>::Value& value) {
         this->validate_access<T>(idx);
-        set_property<T>(
-            reinterpret_cast<const T*>(this->type), 0,
-            reinterpret_cast<uintptr_t>(this->base->data) + (this->type->ElementSize * idx), value);
+        set_property<T>(reinterpret_cast<const T*>(this->type), 0, this->element_addr(idx), value);
+    }
+
+    /**
+     * @brief Gets a span directly over the array's data, after a single type check.
+     * @note Only available for properties whose values are stored as-is, i.e. `CopyableProperty`s.
+     * @note The span is invalidated by anything which changes the array's capacity.
+     *
+     * @tparam T The expected property type
+     * @return A span over the array's elements.
+     */
+    template <typename T>
+        requires is_copyable_property_v<T>
+    [[nodiscard]] std::span<typename PropTraits<T>::Value> as_span(void) {
+        this->validate_type<T>();
+        return {reinterpret_cast<typename PropTraits<T>::Value*>(this->base->data),
+                this->base->size()};
+    }
+    template <typename T>
+        requires is_copyable_property_v<T>
+    [[nodiscard]] std::span<const typename PropTraits<T>::Value> as_span(void) const {
+        this->validate_type<T>();
+        return {reinterpret_cast<const typename PropTraits<T>::Value*>(this->base->data),
+                this->base->size()};
+    }
+
+#pragma region Iterator
+    template <typename T>
+    struct Iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = typename PropTraits<T>::Value;
+        using pointer = value_type*;
+        using reference = value_type;
+
+       private:
+        // Hold our own copies rather than a pointer back to the array, since `items()` is commonly
+        // called on a temporary, which is destroyed before the loop body runs. Copying the pointer
+        // also keeps the parent alive.
+        const UProperty* type;
+        UnrealPointer<TArray<void>> base;
+        size_t idx{};
+
+       public:
+        Iterator(void) : type(nullptr), base(nullptr) {}
+        Iterator(const WrappedArray& arr) : type(arr.type), base(arr.base) {}
+
+        reference operator*() const {
+            auto addr = reinterpret_cast<uintptr_t>(this->base->data)
+                        + (this->type->ElementSize * this->idx);
+            return PropTraits<T>::get(reinterpret_cast<const T*>(this->type), addr, this->base);
+        };
+
+        Iterator& operator++() {
+            ++this->idx;
+            // Use `base == nullptr` as the end condition, so we behave a little better if the array
+            // grows during iteration
+            if (this->idx >= this->base->size()) {
+                this->base = nullptr;
+            }
+            return *this;
+        };
+        Iterator operator++(int) {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const Iterator& rhs) const {
+            if (this->base == nullptr && rhs.base == nullptr) {
+                return true;
+            }
+            return this->base == rhs.base && this->idx == rhs.idx;
+        }
+        bool operator!=(const Iterator& rhs) const { return !(*this == rhs); };
+    };
+
+    /**
+     * @brief Gets a typed range over the array's elements, type checking only once.
+     * @note Will continue to work if the array changes size during iteration. Shrinking beyond the
+     *       element currently pointed at is undefined behaviour.
+     *
+     * @tparam T The expected property type
+     * @return A proxy object which can be used in range based for loops.
+     */
+    template <typename T>
+    [[nodiscard]] utils::IteratorProxy<Iterator<T>> items(void) const {
+        this->validate_type<T>();
+        if (this->size() == 0) {
+            return {Iterator<T>{}, Iterator<T>{}};
+        }
+        return {Iterator<T>{*this}, Iterator<T>{}};
+    }
+#pragma endregion
+
+    /**
+     * @brief Inserts a range of values into the array, shifting all later elements up.
+     *
+     * @tparam T The expected property type
+     * @tparam R The type of the range.
+     * @param idx The index to insert the values at.
+     * @param values The values to insert.
+     */
+    template <typename T, std::ranges::forward_range R>
+    void insert_range(size_t idx, const R& values) {
+        this->validate_type<T>();
+        if (idx > this->size()) {
+            throw std::out_of_range("WrappedArray index out of range");
+        }
+
+        auto count = (size_t)std::ranges::distance(values);
+        if (count == 0) {
+            return;
+        }
+        this->insert_gap(idx, count);
+
+        auto prop = reinterpret_cast<const T*>(this->type);
+        for (const auto& value : values) {
+            PropTraits<T>::set(prop, this->element_addr(idx++), value);
+        }
+    }
+
+    /**
+     * @brief Appends a range of values to the end of the array.
+     *
+     * @tparam T The expected property type
+     * @tparam R The type of the range.
+     * @param values The values to append.
+     */
+    template <typename T, std::ranges::forward_range R>
+    void append_range(const R& values) {
+        this->insert_range<T>(this->size(), values);
+    }
+
+    /**
+     * @brief Removes all elements matching a predicate.
+     * @note Only the removed elements are destroyed, the rest are moved down in place.
+     *
+     * @tparam T The expected property type
+     * @tparam Predicate The type of the predicate.
+     * @param pred The predicate, taking an element value, returning true if it should be removed.
+     * @return The number of elements which were removed.
+     */
+    template <typename T, typename Predicate>
+    size_t remove_if(const Predicate& pred) {
+        this->validate_type<T>();
+
+        auto prop = reinterpret_cast<const T*>(this->type);
+        auto element_size = (size_t)this->type->ElementSize;
+        auto size = this->size();
+
+        size_t write_idx = 0;
+        size_t read_idx = 0;
+        try {
+            for (; read_idx < size; read_idx++) {
+                auto addr = this->element_addr(read_idx);
+                if (pred(PropTraits<T>::get(prop, addr, this->base))) {
+                    PropTraits<T>::destroy(prop, addr);
+                    continue;
+                }
+                if (write_idx != read_idx) {
+                    memmove(reinterpret_cast<void*>(this->element_addr(write_idx)),
+                            reinterpret_cast<void*>(addr), element_size);
+                }
+                write_idx++;
+            }
+        } catch (...) {
+            // If the predicate throws, we may have already destroyed or moved some elements - close
+            // the gap over the ones we haven't checked yet, so that the array remains valid
+            if (write_idx != read_idx) {
+                memmove(reinterpret_cast<void*>(this->element_addr(write_idx)),
+                        reinterpret_cast<void*>(this->element_addr(read_idx)),
+                        (size - read_idx) * element_size);
+            }
+            this->base->count = (decltype(this->base->count))(write_idx + (size - read_idx));
+            throw;
+        }
+
+        this->base->count = (decltype(this->base->count))write_idx;
+        return size - write_idx;
+    }
+
+    /**
+     * @brief Sorts the array.
+     * @note The comparator is run on element values, but the elements themselves are moved as raw
+     *       memory, so no element gets copied or destroyed.
+     *
+     * @tparam T The expected property type
+     * @tparam Compare The type of the comparator.
+     * @param comp The comparator, taking two element values, returning true if the first should be
+     *             ordered before the second.
+     */
+    template <typename T, typename Compare>
+    void sort_by(const Compare& comp) {
+        this->validate_type<T>();
+
+        auto prop = reinterpret_cast<const T*>(this->type);
+        auto size = this->size();
+        if (size < 2) {
+            return;
+        }
+
+        std::vector<typename PropTraits<T>::Value> values{};
+        values.reserve(size);
+        for (size_t idx = 0; idx < size; idx++) {
+            values.push_back(PropTraits<T>::get(prop, this->element_addr(idx), this->base));
+        }
+
+        std::vector<size_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(
+            order, [&](size_t lhs, size_t rhs) { return comp(values[lhs], values[rhs]); });
+        values.clear();
+
+        this->apply_order(order);
     }
 
     /**
@@ -122,9 +387,7 @@ class WrappedArray {
     template <typename T>
     void destroy_at(size_t idx) {
         this->validate_access<T>(idx);
-        destroy_property<T>(
-            reinterpret_cast<const T*>(this->type), 0,
-            reinterpret_cast<uintptr_t>(this->base->data) + (this->type->ElementSize * idx));
+        destroy_property<T>(reinterpret_cast<const T*>(this->type), 0, this->element_addr(idx));
     }
 };
 
@@ -4,42 +4,273 @@
 #include "unrealsdk/unreal/classes/uproperty.h"
 #include "unrealsdk/unreal/classes/ustruct.h"
 #include "unrealsdk/unreal/prop_traits.h"
+#include "unrealsdk/unreal/struct_cache.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer.h"
 #include "unrealsdk/unreal/wrappers/unreal_pointer_funcs.h"
 #include "unrealsdk/unrealsdk.h"
 
 namespace unrealsdk::unreal {
 
+#pragma region Copy Plans
+
+namespace {
+
+/*
+Rather than casting and copying every property one at a time, we build a plan of how to copy each
+struct once, and cache it. Runs of properties which can be copied with a plain memcpy are merged
+into single spans, and only the properties which actually need a deep copy go through PropTraits.
+*/
+
+using copy_func = void (*)(const UProperty* prop, uintptr_t dest, const WrappedStruct& src);
+
+struct CopyStep {
+    size_t offset;
+    size_t size;
+    const UProperty* prop;
+    // If null, this step is just a memcpy of the given span
+    copy_func func;
+};
+
+struct CopyPlans {
+    std::vector<CopyStep> all;
+    std::vector<CopyStep> params;
+    bool trivially_copyable;
+};
+
+/**
+ * @brief Deep copies all values of a property.
+ *
+ * @tparam T The property type.
+ * @param prop The property to copy.
+ * @param dest The address of the struct to copy to.
+ * @param src The source struct to copy from.
+ */
+template <typename T>
+void copy_property(const UProperty* prop, uintptr_t dest, const WrappedStruct& src) {
+    auto typed_prop = reinterpret_cast<const T*>(prop);
+    for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
+        set_property<T>(typed_prop, i, dest, src.get<T>(typed_prop, i));
+    }
+}
+
+/**
+ * @brief Copy function used for properties of unknown types, which throws.
+ *
+ * @param prop The property which was meant to be copied.
+ */
+void copy_unknown_property(const UProperty* prop,
+                           uintptr_t /*dest*/,
+                           const WrappedStruct& /*src*/) {
+    throw std::runtime_error("Unknown object type " + (std::string)prop->Class->Name);
+}
+
+/**
+ * @brief Builds a copy plan for a subset of a struct's properties.
+ *
+ * @param type The struct to build the plan for.
+ * @param params_only True if to only include properties marked as parameters.
+ * @return The copy plan.
+ */
+std::vector<CopyStep> build_copy_plan(const UStruct* type, bool params_only) {
+    std::vector<CopyStep> spans{};
+    std::vector<CopyStep> deep_copies{};
+
+    for (auto prop : type->properties()) {
+        if (params_only && (prop->PropertyFlags & UProperty::PROP_FLAG_PARAM) == 0) {
+            continue;
+        }
+
+        bool trivial = false;
+        copy_func func = nullptr;
+        cast(
+            prop,
+            [params_only, &trivial, &func]<typename T>(const T* prop) {
+                if constexpr (std::is_same_v<T, UStructProperty>) {
+                    trivial = is_trivially_copyable(prop->get_inner_struct());
+                } else if constexpr (std::is_same_v<T, UBoolProperty>) {
+                    // Bools may share their field with other bools - which is fine to copy if
+                    // we're copying everything, but not if we're only copying some properties
+                    trivial = !params_only;
+                } else {
+                    trivial = PropTraits<T>::TRIVIALLY_COPYABLE;
+                }
+                func = &copy_property<T>;
+            },
+            [&func](const UProperty* /*prop*/) { func = &copy_unknown_property; });
+
+        if (trivial) {
+            spans.push_back({.offset = (size_t)prop->Offset_Internal,
+                             .size = (size_t)prop->ElementSize * prop->ArrayDim,
+                             .prop = prop,
+                             .func = nullptr});
+        } else {
+            deep_copies.push_back(
+                {.offset = (size_t)prop->Offset_Internal, .size = 0, .prop = prop, .func = func});
+        }
+    }
+
+    std::sort(spans.begin(), spans.end(),
+              [](const CopyStep& lhs, const CopyStep& rhs) { return lhs.offset < rhs.offset; });
+
+    std::vector<CopyStep> plan{};
+    for (const auto& span : spans) {
+        // Merge contiguous (or overlapping, in the case of bools) spans
+        if (!plan.empty() && span.offset <= plan.back().offset + plan.back().size) {
+            auto& last = plan.back();
+            last.size = std::max(last.offset + last.size, span.offset + span.size) - last.offset;
+            continue;
+        }
+        plan.push_back(span);
+    }
+    plan.insert(plan.end(), deep_copies.begin(), deep_copies.end());
+
+    return plan;
+}
+
+StructCache<CopyPlans> copy_plan_cache{[](const UStruct* type) -> CopyPlans {
+    auto all = build_copy_plan(type, false);
+    auto trivially_copyable = std::ranges::all_of(all, [](const CopyStep& step) {
+        return step.func == nullptr;
+    });
+    return {.all = std::move(all),
+            .params = build_copy_plan(type, true),
+            .trivially_copyable = trivially_copyable};
+}};
+
+/**
+ * @brief Runs a copy plan.
+ *
+ * @param plan The plan to run.
+ * @param dest The address of the struct to copy to.
+ * @param src The source struct to copy from.
+ */
+void run_copy_plan(const std::vector<CopyStep>& plan, uintptr_t dest, const WrappedStruct& src) {
+    auto src_addr = reinterpret_cast<uintptr_t>(src.base.get());
+    if (dest == src_addr) {
+        return;
+    }
+
+    for (const auto& step : plan) {
+        if (step.func == nullptr) {
+            memcpy(reinterpret_cast<void*>(dest + step.offset),
+                   reinterpret_cast<void*>(src_addr + step.offset), step.size);
+        } else {
+            step.func(step.prop, dest, src);
+        }
+    }
+}
+
+}  // namespace
+
+bool is_trivially_copyable(const UStruct* type) {
+    return copy_plan_cache.get(type)->trivially_copyable;
+}
+
 void copy_struct(uintptr_t dest, const WrappedStruct& src) {
-    for (const auto& prop : src.type->properties()) {
-        cast(prop, [dest, &src]<typename T>(const T* prop) {
-            for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
-                set_property<T>(prop, i, dest, src.get<T>(prop, i));
-            }
-        });
+    run_copy_plan(copy_plan_cache.get(src.type)->all, dest, src);
+}
+
+#pragma endregion
+
+#pragma region Destroy Plans
+
+namespace {
+
+/*
+Similarly, most properties don't need destroying at all, so we cache a list of just the properties
+which do. This is equivalent to the destructor link unreal keeps on UE4, but we build it ourselves
+since it's not available on UE3, and since on UE4 it skips anything handled by native destructors.
+*/
+
+using destroy_func = void (*)(const UProperty* prop, uintptr_t addr);
+
+struct DestroyStep {
+    const UProperty* prop;
+    destroy_func func;
+};
+
+/**
+ * @brief Destroys all values of a property.
+ *
+ * @tparam T The property type.
+ * @param prop The property to destroy.
+ * @param addr The address of the struct getting destroyed.
+ */
+template <typename T>
+void destroy_property_values(const UProperty* prop, uintptr_t addr) {
+    auto typed_prop = reinterpret_cast<const T*>(prop);
+    for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
+        destroy_property<T>(typed_prop, i, addr);
     }
 }
 
+StructCache<std::vector<DestroyStep>> destroy_plan_cache{
+    [](const UStruct* type) -> std::vector<DestroyStep> {
+        std::vector<DestroyStep> plan{};
+
+        for (auto prop : type->properties()) {
+            destroy_func func = nullptr;
+            cast(
+                prop,
+                [&func]<typename T>(const T* prop) {
+                    if constexpr (std::is_same_v<T, UStructProperty>) {
+                        if (is_trivially_destructible(prop->get_inner_struct())) {
+                            return;
+                        }
+                    } else if constexpr (PropTraits<T>::TRIVIALLY_DESTRUCTIBLE) {
+                        return;
+                    }
+                    func = &destroy_property_values<T>;
+                },
+                [type](const UProperty* prop) {
+                    // Log it to dev warning - don't want to use error to not freak out casusal
+                    // users, this should only really happen if a dev is messing with unsupported
+                    // property types.
+                    LOG(DEV_WARNING, "Error while destroying '{}' struct: Unknown object type {}",
+                        type->Name, prop->Class->Name);
+                });
+
+            if (func != nullptr) {
+                plan.push_back({.prop = prop, .func = func});
+            }
+        }
+
+        return plan;
+    }};
+
+}  // namespace
+
+bool is_trivially_destructible(const UStruct* type) {
+    return destroy_plan_cache.get(type)->empty();
+}
+
 void destroy_struct(const UStruct* type, uintptr_t addr) {
-    for (const auto& prop : type->properties()) {
+    // It's important not to throw, this is called during destructors, just continue, keep on
+    // trying to destroy the rest
+    std::shared_ptr<const std::vector<DestroyStep>> plan{};
+    try {
+        plan = destroy_plan_cache.get(type);
+    } catch (const std::exception& ex) {
+        LOG(DEV_WARNING, "Error while destroying '{}' struct: {}", type->Name, ex.what());
+        return;
+    }
+
+    for (const auto& step : *plan) {
         try {
-            cast(prop, [addr]<typename T>(const T* prop) {
-                for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
-                    destroy_property<T>(prop, i, addr);
-                }
-            });
+            step.func(step.prop, addr);
         } catch (const std::exception& ex) {
-            // It's important not to throw, this is called during destructors, just continue, keep
-            // on trying to destroy the rest
-            // Log it to dev warning - don't want to use error to not freak out casusal users, this
-            // should only really happen if a dev is messing with unsupported property types.
             LOG(DEV_WARNING, "Error while destroying '{}' struct: {}", type->Name, ex.what());
         }
     }
 }
 
+#pragma endregion
+
 WrappedStruct::WrappedStruct(const UStruct* type) : type(type), base(type) {}
 
+WrappedStruct::WrappedStruct(const UStruct* type, PooledAllocation pooled)
+    : type(type), base(type, pooled) {}
+
 WrappedStruct::WrappedStruct(const UStruct* type, void* base, const UnrealPointer<void>& parent)
     : type(type), base(parent, base) {}
 
@@ -68,25 +299,33 @@ WrappedStruct& WrappedStruct::operator=(WrappedStruct&& other) noexcept {
 }
 
 WrappedStruct WrappedStruct::copy_params_only(void) const {
-    WrappedStruct new_struct{this->type};
+    WrappedStruct new_struct{this->type, PooledAllocation{}};
     if (this->base == nullptr || new_struct.base == nullptr) {
         return new_struct;
     }
 
-    auto dest = reinterpret_cast<uintptr_t>(new_struct.base.get());
-    for (const auto& prop : this->type->properties()) {
-        if ((prop->PropertyFlags & UProperty::PROP_FLAG_PARAM) == 0) {
-            continue;
-        }
+    run_copy_plan(copy_plan_cache.get(this->type)->params,
+                  reinterpret_cast<uintptr_t>(new_struct.base.get()), *this);
 
-        cast(prop, [dest, this]<typename T>(const T* prop) {
-            for (size_t i = 0; i < (size_t)prop->ArrayDim; i++) {
-                set_property<T>(prop, i, dest, this->get<T>(prop, i));
-            }
-        });
+    return new_struct;
+}
+
+// Deliberately leaving the buffer uninitialized, we only need to clear the part we're using
+// NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+StackWrappedStruct::StackWrappedStruct(const UStruct* type)
+    : is_inline(type->get_struct_size() <= MAX_INLINE_SIZE),
+      wrapped(this->is_inline ? WrappedStruct{type, this->buffer.data()}
+                              : WrappedStruct{type, PooledAllocation{}}) {
+    if (this->is_inline) {
+        memset(this->buffer.data(), 0, type->get_struct_size());
     }
+}
 
-    return new_struct;
+StackWrappedStruct::~StackWrappedStruct() {
+    // Pooled allocations clean up after themselves, we only need to handle the inline case
+    if (this->is_inline) {
+        destroy_struct(this->wrapped.type, reinterpret_cast<uintptr_t>(this->buffer.data()));
+    }
 }
 
 }  // namespace unrealsdk::unreal
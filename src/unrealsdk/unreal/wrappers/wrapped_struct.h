@@ -21,6 +21,8 @@ class WrappedStruct {
     /**
      * @brief Constructs a new wrapped struct.
      * @note If just the type is given, allocates new memory (which we manage) for the properties.
+     * @note If given the pooled tag, this memory is taken from the pool, which is intended for
+     *       short lived structs.
      * @note If a parent is given, copies it's ownership.
      * @note Otherwise, does not manage the given base address.
      *
@@ -30,6 +32,7 @@ class WrappedStruct {
      * @param other The other wrapped struct to copy/move from. Only allowed if of the same type.
      */
     WrappedStruct(const UStruct* type);
+    WrappedStruct(const UStruct* type, PooledAllocation pooled);
     WrappedStruct(const UStruct* type, void* base, const UnrealPointer<void>& parent = {nullptr});
     WrappedStruct(const WrappedStruct& other);
     WrappedStruct(WrappedStruct&& other) noexcept;
@@ -104,6 +107,65 @@ class WrappedStruct {
     [[nodiscard]] WrappedStruct copy_params_only(void) const;
 };
 
+/**
+ * @brief A wrapped struct which stores small structs inline, rather than allocating new memory.
+ * @note Intended to be used as a local variable, to put short lived structs on the stack. Anything
+ *       referencing the inline memory (including sub-structs, arrays, and other values retrieved
+ *       from it) is only valid until this goes out of scope. Copying the wrapped struct creates an
+ *       independent copy, which is safe to keep.
+ */
+class StackWrappedStruct {
+   public:
+    static constexpr size_t MAX_INLINE_SIZE = 0x200;
+
+   private:
+    alignas(std::max_align_t) std::array<uint8_t, MAX_INLINE_SIZE> buffer;
+    bool is_inline;
+    WrappedStruct wrapped;
+
+   public:
+    /**
+     * @brief Constructs a new zero-initialized struct.
+     * @note Falls back to a pooled allocation if the struct is too large to store inline.
+     *
+     * @param type The type of the struct.
+     */
+    explicit StackWrappedStruct(const UStruct* type);
+
+    /**
+     * @brief Destroys the struct, and all properties on it.
+     */
+    ~StackWrappedStruct();
+
+    StackWrappedStruct(const StackWrappedStruct&) = delete;
+    StackWrappedStruct(StackWrappedStruct&&) = delete;
+    StackWrappedStruct& operator=(const StackWrappedStruct&) = delete;
+    StackWrappedStruct& operator=(StackWrappedStruct&&) = delete;
+
+    /**
+     * @brief Gets the wrapped struct.
+     *
+     * @return A reference to the wrapped struct.
+     */
+    [[nodiscard]] WrappedStruct& get(void) { return this->wrapped; }
+};
+
+/**
+ * @brief Checks if all properties on a struct may be copied with a plain memcpy.
+ *
+ * @param type The type of the struct.
+ * @return True if the struct is trivially copyable.
+ */
+[[nodiscard]] bool is_trivially_copyable(const UStruct* type);
+
+/**
+ * @brief Checks if a struct has no properties which need to be destroyed.
+ *
+ * @param type The type of the struct.
+ * @return True if the struct is trivially destructible.
+ */
+[[nodiscard]] bool is_trivially_destructible(const UStruct* type);
+
 /**
  * @brief Recursively copies all properties on a struct.
  *
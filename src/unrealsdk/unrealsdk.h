@@ -134,6 +134,18 @@ void u_free(void* data);
  */
 void process_event(unreal::UObject* object, unreal::UFunction* func, void* params);
 
+/**
+ * @brief Tries calling a native function directly, skipping `UObject::ProcessEvent`.
+ * @note Not currently supported on any game, this always returns false. Reserved for once calling
+ *       natives directly can be done safely.
+ *
+ * @param object The object to call the function on.
+ * @param func The function to call.
+ * @param params The function's params
+ * @return True if the function was called, false if it needs to go through `process_event`.
+ */
+[[nodiscard]] bool call_native(unreal::UObject* object, unreal::UFunction* func, void* params);
+
 /**
  * @brief Constructs a new object
  *
@@ -38,6 +38,7 @@ UNREALSDK_CAPI([[nodiscard]] void*, u_malloc, size_t len);
 UNREALSDK_CAPI([[nodiscard]] void*, u_realloc, void* original, size_t len);
 UNREALSDK_CAPI(void, u_free, void* data);
 UNREALSDK_CAPI(void, process_event, UObject* object, UFunction* function, void* params);
+UNREALSDK_CAPI([[nodiscard]] bool, call_native, UObject* object, UFunction* function, void* params);
 UNREALSDK_CAPI([[nodiscard]] UObject*,
                construct_object,
                UClass* cls,
@@ -4,7 +4,9 @@
 #include "unrealsdk/game/abstract_hook.h"
 #include "unrealsdk/hook_manager.h"
 #include "unrealsdk/logging.h"
+#include "unrealsdk/tasks.h"
 #include "unrealsdk/unreal/find_class.h"
+#include "unrealsdk/unreal/fname_index.h"
 #include "unrealsdk/unrealsdk.h"
 #include "unrealsdk/version.h"
 
@@ -68,6 +70,9 @@ bool init(const std::function<std::unique_ptr<game::AbstractHook>(void)>& game_g
     // Initialize the hook before moving it, to weed out any order of initialization problems.
     game->hook();
     hook_instance = std::move(game);
+
+    tasks::impl::init();
+
     return true;
 }
 
@@ -89,6 +94,9 @@ UNREALSDK_CAPI([[nodiscard]] const GNames*, gnames) {
 }
 
 UNREALSDK_CAPI(void, fname_init, FName* name, const wchar_t* str, int32_t number) {
+    if (find_existing_fname(name, str, number)) {
+        return;
+    }
     hook_instance->fname_init(name, str, number);
 }
 
@@ -127,6 +135,14 @@ UNREALSDK_CAPI(void, process_event, UObject* object, UFunction* function, void*
     hook_instance->process_event(object, function, params);
 }
 
+UNREALSDK_CAPI([[nodiscard]] bool,
+               call_native,
+               UObject* object,
+               UFunction* function,
+               void* params) {
+    return hook_instance->call_native(object, function, params);
+}
+
 UNREALSDK_CAPI([[nodiscard]] UObject*,
                construct_object,
                UClass* cls,
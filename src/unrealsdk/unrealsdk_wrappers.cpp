@@ -55,6 +55,10 @@ void process_event(UObject* object, UFunction* function, void* params) {
     UNREALSDK_MANGLE(process_event)(object, function, params);
 }
 
+bool call_native(UObject* object, UFunction* function, void* params) {
+    return UNREALSDK_MANGLE(call_native)(object, function, params);
+}
+
 UObject* construct_object(UClass* cls,
                           UObject* outer,
                           const FName& name,